@@ -34,3 +34,8 @@
 // - `CHARYBDIS_AUTO_POINTER_LAYER_TRIGGER_THRESHOLD`
 // #define CHARYBDIS_AUTO_POINTER_LAYER_TRIGGER_ENABLE
 #endif // POINTING_DEVICE_ENABLE
+
+#ifdef RGB_INDICATOR_ENABLE
+// Sync the layer state so that both halves paint the layer indicators.
+#    define SPLIT_LAYER_STATE_ENABLE
+#endif // RGB_INDICATOR_ENABLE
@@ -21,10 +21,8 @@
 
 #include QMK_KEYBOARD_H
 #include "keymap_german.h"  // https://github.com/qmk/qmk_firmware/blob/master/quantum/keymap_extras/keymap_german.h
-
-#ifdef CHARYBDIS_AUTO_POINTER_LAYER_TRIGGER_ENABLE
-#    include "timer.h"
-#endif // CHARYBDIS_AUTO_POINTER_LAYER_TRIGGER_ENABLE
+#include "sendstring_german.h"  // SEND_STRING and send_burst_string for a German host layout
+#include "bastardkb.h"
 
 enum charybdis_keymap_layers {
     LAYER_BASE = 0,
@@ -37,18 +35,6 @@ enum charybdis_keymap_layers {
 /** \brief Automatically enable sniping-mode on the pointer layer. */
 #define CHARYBDIS_AUTO_SNIPING_ON_LAYER LAYER_POINTER
 
-#ifdef CHARYBDIS_AUTO_POINTER_LAYER_TRIGGER_ENABLE
-static uint16_t auto_pointer_layer_timer = 0;
-
-#    ifndef CHARYBDIS_AUTO_POINTER_LAYER_TRIGGER_TIMEOUT_MS
-#        define CHARYBDIS_AUTO_POINTER_LAYER_TRIGGER_TIMEOUT_MS 1000
-#    endif // CHARYBDIS_AUTO_POINTER_LAYER_TRIGGER_TIMEOUT_MS
-
-#    ifndef CHARYBDIS_AUTO_POINTER_LAYER_TRIGGER_THRESHOLD
-#        define CHARYBDIS_AUTO_POINTER_LAYER_TRIGGER_THRESHOLD 8
-#    endif // CHARYBDIS_AUTO_POINTER_LAYER_TRIGGER_THRESHOLD
-#endif     // CHARYBDIS_AUTO_POINTER_LAYER_TRIGGER_ENABLE
-
 #define SYMBOL MO(LAYER_SYMBOL)
 #define NAVIGATION MO(LAYER_NAVIGATION)
 #define NUMBERS MO(LAYER_NUMBERS)
@@ -79,6 +65,7 @@ enum custom_keycodes {
 // * TAP DANCE
 // ********************************************************************
 // taken from example 3: https://docs.qmk.fm/features/tap_dance#examples
+#ifdef TAP_DANCE_ENABLE
 void tap_dance_tap_hold_finished(tap_dance_state_t *state, void *user_data);
 void tap_dance_tap_hold_reset(tap_dance_state_t *state, void *user_data);
 
@@ -98,25 +85,39 @@ tap_dance_action_t tap_dance_actions[] = {
     [Q_QU] = ACTION_TAP_DANCE_TAP_HOLD(KC_Q, YOUR_MACRO_1)
 };
 
-bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+#    define TD_Q_QU TD(Q_QU)
+#else
+#    define TD_Q_QU KC_Q
+#endif // TAP_DANCE_ENABLE
+
+bool process_record_keymap(uint16_t keycode, keyrecord_t *record) {
+#ifdef TAP_DANCE_ENABLE
     tap_dance_action_t *action;
+#endif // TAP_DANCE_ENABLE
 
     switch (keycode) {
+#ifdef TAP_DANCE_ENABLE
         case TD(Q_QU):  // Tap Dance Q/QU - list all tap dance keycodes with tap-hold configurations
             action = &tap_dance_actions[QK_TAP_DANCE_GET_INDEX(keycode)];
             if (!record->event.pressed && action->state.count && !action->state.finished) {
                 tap_dance_tap_hold_t *tap_hold = (tap_dance_tap_hold_t *)action->user_data;
                 tap_code16(tap_hold->tap);
             }
+#endif // TAP_DANCE_ENABLE
         case YOUR_MACRO_1:  // Actual Macro QU
             if (record->event.pressed) {
+#ifdef BURST_MACRO_ENABLE
+                send_burst_string("qu");  // single report for both keys
+#else
                 SEND_STRING("qu");
+#endif // BURST_MACRO_ENABLE
             }
             return false;
     }
     return true;
 }
 
+#ifdef TAP_DANCE_ENABLE
 void tap_dance_tap_hold_finished(tap_dance_state_t *state, void *user_data) {
     tap_dance_tap_hold_t *tap_hold = (tap_dance_tap_hold_t *)user_data;
 
@@ -143,6 +144,7 @@ void tap_dance_tap_hold_reset(tap_dance_state_t *state, void *user_data) {
         tap_hold->held = 0;
     }
 }
+#endif // TAP_DANCE_ENABLE
 
 #define OSM_LC OSM(MOD_LCTL)
 #define OSM_LS OSM(MOD_LSFT)
@@ -171,7 +173,7 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
   // ├──────────────────────────────────────────────────────┤ ├──────────────────────────────────────────────────────┤
        XXXXXXX,    KC_R,    KC_S,    KC_N,    KC_T,    KC_B,    KC_COMMA,   KC_A,    KC_E,    KC_I,    KC_H, XXXXXXX,
   // ├──────────────────────────────────────────────────────┤ ├──────────────────────────────────────────────────────┤
-       XXXXXXX,    PT_X,    KC_C,    KC_L,    KC_D,    KC_G,    TD(Q_QU),   KC_U,    KC_O,    DE_Y,    KC_K, XXXXXXX,
+       XXXXXXX,    PT_X,    KC_C,    KC_L,    KC_D,    KC_G,     TD_Q_QU,   KC_U,    KC_O,    DE_Y,    KC_K, XXXXXXX,
   // ╰──────────────────────────────────────────────────────┤ ├──────────────────────────────────────────────────────╯
                                NAVIGATION, KC_LSFT, XXXXXXX,  KC_SPC, SYMBOL,
                                            XXXXXXX, XXXXXXX,     NUMBERS
@@ -239,10 +241,16 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
   )
 };
 
+#ifdef SPARSE_KEYMAP_ENABLE
+// Generated from `keymaps` at build time, see users/bastardkb/readme.md.
+#    include "sparse_keymap_data.h"
+#endif // SPARSE_KEYMAP_ENABLE
+
 // ********************************************************************
 // COMBOS
 // ********************************************************************
 
+#if defined(COMBO_ENABLE) || defined(INDEXED_COMBO_ENABLE)
 const uint16_t PROGMEM overview[] = {KC_F, KC_M, COMBO_END};
 const uint16_t PROGMEM cut[] = {KC_X, KC_C, COMBO_END};
 const uint16_t PROGMEM copy[] = {KC_C, KC_L, COMBO_END};
@@ -276,43 +284,70 @@ combo_t key_combos[] = {
     COMBO(num_layer, NUMBERS)
 };
 
+#    ifdef INDEXED_COMBO_ENABLE
+const uint16_t key_combos_count = ARRAY_SIZE(key_combos);
+#    endif // INDEXED_COMBO_ENABLE
+#endif     // COMBO_ENABLE || INDEXED_COMBO_ENABLE
+
 // clang-format on
 
 #ifdef POINTING_DEVICE_ENABLE
-#    ifdef CHARYBDIS_AUTO_POINTER_LAYER_TRIGGER_ENABLE
-report_mouse_t pointing_device_task_user(report_mouse_t mouse_report) {
-    if (abs(mouse_report.x) > CHARYBDIS_AUTO_POINTER_LAYER_TRIGGER_THRESHOLD || abs(mouse_report.y) > CHARYBDIS_AUTO_POINTER_LAYER_TRIGGER_THRESHOLD) {
-        if (auto_pointer_layer_timer == 0) {
-            layer_on(LAYER_POINTER);
-#        ifdef RGB_MATRIX_ENABLE
-            rgb_matrix_mode_noeeprom(RGB_MATRIX_NONE);
-            rgb_matrix_sethsv_noeeprom(HSV_GREEN);
-#        endif // RGB_MATRIX_ENABLE
-        }
-        auto_pointer_layer_timer = timer_read();
-    }
-    return mouse_report;
-}
-
-void matrix_scan_user(void) {
-    if (auto_pointer_layer_timer != 0 && TIMER_DIFF_16(timer_read(), auto_pointer_layer_timer) >= CHARYBDIS_AUTO_POINTER_LAYER_TRIGGER_TIMEOUT_MS) {
-        auto_pointer_layer_timer = 0;
-        layer_off(LAYER_POINTER);
-#        ifdef RGB_MATRIX_ENABLE
-        rgb_matrix_mode_noeeprom(RGB_MATRIX_DEFAULT_MODE);
-#        endif // RGB_MATRIX_ENABLE
-    }
-}
-#    endif // CHARYBDIS_AUTO_POINTER_LAYER_TRIGGER_ENABLE
+#    ifdef AUTO_POINTER_ENABLE
+const uint8_t auto_pointer_layer = LAYER_POINTER;
+#    endif // AUTO_POINTER_ENABLE
 
 #    ifdef CHARYBDIS_AUTO_SNIPING_ON_LAYER
-layer_state_t layer_state_set_user(layer_state_t state) {
+layer_state_t layer_state_set_keymap(layer_state_t state) {
     charybdis_set_pointer_sniping_enabled(layer_state_cmp(state, CHARYBDIS_AUTO_SNIPING_ON_LAYER));
     return state;
 }
 #    endif // CHARYBDIS_AUTO_SNIPING_ON_LAYER
 #endif     // POINTING_DEVICE_ENABLE
 
+#ifdef DRAG_SCROLL_ENABLE
+/** \brief Drag-scroll state of the primary half, synced to the secondary half for its RGB indicators. */
+static bool drag_scroll_shown = false;
+
+#    ifdef SPLIT_SYNC_ENABLE
+void keyboard_post_init_keymap(void) {
+    split_sync_register(&drag_scroll_shown, sizeof(drag_scroll_shown));
+}
+
+void split_sync_received_keymap(uint8_t fields) {
+#        ifdef RGB_INDICATOR_ENABLE
+    rgb_indicator_refresh();
+#        endif // RGB_INDICATOR_ENABLE
+}
+#    endif // SPLIT_SYNC_ENABLE
+
+void housekeeping_task_keymap(void) {
+    if (is_keyboard_master() && drag_scroll_shown != drag_scroll_is_enabled()) {
+        drag_scroll_shown = drag_scroll_is_enabled();
+#    ifdef RGB_INDICATOR_ENABLE
+        rgb_indicator_refresh();
+#    endif // RGB_INDICATOR_ENABLE
+    }
+}
+#endif // DRAG_SCROLL_ENABLE
+
+#ifdef RGB_INDICATOR_ENABLE
+bool rgb_indicator_layer_color_keymap(uint8_t layer, HSV *hsv) {
+    switch (layer) {
+        case LAYER_POINTER:
+#    ifdef DRAG_SCROLL_ENABLE
+            if (drag_scroll_shown) {
+                *hsv = (HSV){HSV_AZURE};
+                return true;
+            }
+#    endif // DRAG_SCROLL_ENABLE
+            *hsv = (HSV){HSV_GREEN};
+            return true;
+        default:
+            return false;
+    }
+}
+#endif // RGB_INDICATOR_ENABLE
+
 #ifdef RGB_MATRIX_ENABLE
 // Forward-declare this helper function since it is defined in rgb_matrix.c.
 void rgb_matrix_update_pwm_buffers(void);
@@ -1,3 +1,17 @@
+USER_NAME := bastardkb
+
 VIA_ENABLE = no
 COMBO_ENABLE = yes
 TAP_DANCE_ENABLE = yes
+
+# Userspace features, see users/bastardkb/readme.md.
+LATENCY_STATS_ENABLE = no
+HOOK_PROFILER_ENABLE = no
+TRACE_ENABLE = no
+INDEXED_COMBO_ENABLE = yes
+POINTER_ACCEL_ENABLE = yes
+BURST_MACRO_ENABLE = yes
+RGB_INDICATOR_ENABLE = yes
+SPARSE_KEYMAP_ENABLE = yes
+DRAG_SCROLL_ENABLE = yes
+SPLIT_SYNC_ENABLE = yes
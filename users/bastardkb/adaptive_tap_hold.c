@@ -0,0 +1,208 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "adaptive_tap_hold.h"
+#ifdef TRACE_ENABLE
+#    include "trace.h"
+#endif // TRACE_ENABLE
+
+#define IS_TAP_HOLD(keycode) (IS_QK_MOD_TAP(keycode) || IS_QK_LAYER_TAP(keycode))
+
+typedef struct {
+    keypos_t key;
+    uint16_t pressed;    // Time of the last press.
+    uint16_t tap_ewma;   // Moving average of the tap durations, in milliseconds.
+    bool     streak;     // Whether the last press was in a typing streak.
+    bool     unresolved; // Pressed, passed on to QMK, and not processed yet.
+} adaptive_key_t;
+
+typedef struct {
+    keypos_t key;
+    uint16_t keycode;
+} adaptive_instant_t;
+
+static adaptive_key_t     adaptive_keys[ADAPTIVE_TAP_HOLD_MAX_KEYS];
+static uint8_t            adaptive_key_count = 0;
+static adaptive_instant_t adaptive_instant[ADAPTIVE_TAP_HOLD_MAX_INSTANT];
+static uint8_t            adaptive_instant_count = 0;
+
+static keypos_t adaptive_last_press;
+static uint16_t adaptive_last_typed     = 0;
+static uint16_t adaptive_typed_interval = ADAPTIVE_TAP_HOLD_STREAK_MS;
+
+__attribute__((weak)) adaptive_hand_t adaptive_tap_hold_hand(keypos_t key) {
+#ifdef SPLIT_KEYBOARD
+    const uint8_t   half_rows = MATRIX_ROWS / 2;
+    adaptive_hand_t hand      = key.row < half_rows ? ADAPTIVE_HAND_LEFT : ADAPTIVE_HAND_RIGHT;
+    return key.row % half_rows == half_rows - 1 ? hand | ADAPTIVE_HAND_THUMB : hand;
+#else
+    return key.col < MATRIX_COLS / 2 ? ADAPTIVE_HAND_LEFT : ADAPTIVE_HAND_RIGHT;
+#endif // SPLIT_KEYBOARD
+}
+
+static adaptive_key_t *adaptive_key(keypos_t key, bool add) {
+    for (uint8_t i = 0; i < adaptive_key_count; ++i) {
+        if (KEYEQ(adaptive_keys[i].key, key)) {
+            return &adaptive_keys[i];
+        }
+    }
+    if (!add || adaptive_key_count >= ADAPTIVE_TAP_HOLD_MAX_KEYS) {
+        return NULL;
+    }
+    adaptive_key_t *entry = &adaptive_keys[adaptive_key_count++];
+    *entry                = (adaptive_key_t){.key = key, .tap_ewma = ADAPTIVE_TAP_HOLD_MAX_TERM - ADAPTIVE_TAP_HOLD_MARGIN_MS};
+    return entry;
+}
+
+static bool adaptive_in_streak(keyrecord_t *record) {
+    uint16_t window = adaptive_typed_interval * 2;
+    if (window > ADAPTIVE_TAP_HOLD_STREAK_MS) {
+        window = ADAPTIVE_TAP_HOLD_STREAK_MS;
+    }
+    // Keys pressed while holding a modifier other than shift are shortcuts.
+    return TIMER_DIFF_16(record->event.time, adaptive_last_typed) < window && !(get_mods() & ~MOD_MASK_SHIFT);
+}
+
+static void adaptive_typed(keyrecord_t *record) {
+    uint16_t interval = TIMER_DIFF_16(record->event.time, adaptive_last_typed);
+    if (interval > ADAPTIVE_TAP_HOLD_STREAK_MS * 2) {
+        interval = ADAPTIVE_TAP_HOLD_STREAK_MS * 2;
+    }
+    adaptive_typed_interval = (adaptive_typed_interval * 3 + interval) / 4;
+    adaptive_last_typed     = record->event.time;
+}
+
+/**
+ * \brief Whether a tap-hold key passed on to QMK is still undecided.
+ *
+ * QMK decides within the tapping term: a press not processed by then was
+ * swallowed on its way (eg. by another `pre_process_record` handler), and is
+ * forgotten.
+ */
+static bool adaptive_any_unresolved(uint16_t time) {
+    bool unresolved = false;
+    for (uint8_t i = 0; i < adaptive_key_count; ++i) {
+        adaptive_key_t *entry = &adaptive_keys[i];
+        if (entry->unresolved && TIMER_DIFF_16(time, entry->pressed) > ADAPTIVE_TAP_HOLD_MAX_TERM) {
+            entry->unresolved = false;
+        }
+        unresolved |= entry->unresolved;
+    }
+    return unresolved;
+}
+
+/** \brief Release an instant tap, returns false if the key was not one. */
+static bool adaptive_instant_release(keypos_t key) {
+    for (uint8_t i = 0; i < adaptive_instant_count; ++i) {
+        if (KEYEQ(adaptive_instant[i].key, key)) {
+            unregister_code16(adaptive_instant[i].keycode);
+#ifdef TRACE_ENABLE
+            trace_action(key, adaptive_instant[i].keycode, 0);
+#endif // TRACE_ENABLE
+            adaptive_instant[i] = adaptive_instant[--adaptive_instant_count];
+            return true;
+        }
+    }
+    return false;
+}
+
+bool process_adaptive_tap_hold(uint16_t keycode, keyrecord_t *record) {
+    if (!IS_KEYEVENT(record->event)) {
+        return true;
+    }
+    if (!record->event.pressed) {
+        // A released tap-hold key is decided, before the next press.
+        adaptive_key_t *entry = adaptive_key(record->event.key, false);
+        if (entry != NULL) {
+            entry->unresolved = false;
+        }
+        return !adaptive_instant_release(record->event.key);
+    }
+
+    adaptive_last_press = record->event.key;
+    if (!IS_TAP_HOLD(keycode)) {
+        adaptive_typed(record);
+        return true;
+    }
+    bool            streak = adaptive_in_streak(record);
+    adaptive_key_t *entry  = adaptive_key(record->event.key, true);
+    if (entry != NULL) {
+        entry->pressed    = record->event.time;
+        entry->streak     = streak;
+        entry->unresolved = false;
+    }
+
+    // Registering the tap while earlier tap-hold keys are undecided would
+    // send it before them.
+    if (streak && !adaptive_any_unresolved(record->event.time) && adaptive_instant_count < ADAPTIVE_TAP_HOLD_MAX_INSTANT && !(adaptive_tap_hold_hand(record->event.key) & ADAPTIVE_HAND_THUMB)) {
+        uint16_t tap = IS_QK_MOD_TAP(keycode) ? QK_MOD_TAP_GET_TAP_KEYCODE(keycode) : QK_LAYER_TAP_GET_TAP_KEYCODE(keycode);
+        adaptive_instant[adaptive_instant_count++] = (adaptive_instant_t){.key = record->event.key, .keycode = tap};
+        register_code16(tap);
+#ifdef TRACE_ENABLE
+        trace_action(record->event.key, tap, TRACE_PRESSED);
+#endif // TRACE_ENABLE
+        adaptive_typed(record);
+        return false;
+    }
+    if (entry != NULL) {
+        entry->unresolved = true;
+    }
+    return true;
+}
+
+void adaptive_tap_hold_record(uint16_t keycode, keyrecord_t *record) {
+    if (!IS_KEYEVENT(record->event) || !IS_TAP_HOLD(keycode)) {
+        return;
+    }
+    adaptive_key_t *entry = adaptive_key(record->event.key, false);
+    if (record->event.pressed) {
+        if (entry != NULL) {
+            entry->unresolved = false;
+        }
+        if (record->tap.count > 0) {
+            adaptive_typed(record);
+        }
+        return;
+    }
+    if (entry != NULL && record->tap.count > 0) {
+        uint16_t duration = TIMER_DIFF_16(record->event.time, entry->pressed);
+        entry->tap_ewma   = (entry->tap_ewma * 7 + duration) / 8;
+    }
+}
+
+uint16_t get_tapping_term(uint16_t keycode, keyrecord_t *record) {
+    adaptive_key_t *entry = adaptive_key(record->event.key, false);
+    if (entry == NULL) {
+        return TAPPING_TERM;
+    }
+    uint16_t term = entry->tap_ewma + ADAPTIVE_TAP_HOLD_MARGIN_MS;
+    if (term < ADAPTIVE_TAP_HOLD_MIN_TERM) {
+        return ADAPTIVE_TAP_HOLD_MIN_TERM;
+    }
+    return term > ADAPTIVE_TAP_HOLD_MAX_TERM ? ADAPTIVE_TAP_HOLD_MAX_TERM : term;
+}
+
+bool get_hold_on_other_key_press(uint16_t keycode, keyrecord_t *record) {
+    // Keys pressed mid-word are rolled into the next key, not held.
+    adaptive_key_t *entry = adaptive_key(record->event.key, false);
+    if (entry != NULL && entry->streak) {
+        return false;
+    }
+    // Thumb keys included: a thumb and a finger of the same hand often roll.
+    adaptive_hand_t hand  = adaptive_tap_hold_hand(record->event.key);
+    adaptive_hand_t other = adaptive_tap_hold_hand(adaptive_last_press);
+    return !(other & ADAPTIVE_HAND_THUMB) && (other & ADAPTIVE_HAND_RIGHT) != (hand & ADAPTIVE_HAND_RIGHT);
+}
@@ -0,0 +1,88 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "quantum.h"
+
+/*
+ * Adaptive tap-hold resolver, for mod-tap (eg. home row mods) and layer-tap
+ * keys.
+ *
+ * - Typing streak: a tap-hold key pressed shortly after a typed key is a tap,
+ *   sent right away instead of once released.  The streak window follows the
+ *   typing speed: twice the average time between typed keys, at most
+ *   `ADAPTIVE_TAP_HOLD_STREAK_MS`.  Thumb keys, usually held mid-word, are
+ *   excluded.
+ * - Opposite hands: a tap-hold key, thumb keys included, is held as soon as a
+ *   finger key of the other hand is pressed, unless it was pressed in a typing
+ *   streak.  Keys of the same hand wait for the tapping term.
+ * - Per-key tapping term: the tapping term of each key is learned from how long
+ *   its taps last, `ADAPTIVE_TAP_HOLD_MARGIN_MS` above their moving average.
+ *
+ * Hands are found from the matrix: on split keyboards, the left half's rows
+ * come first and the last row of each half holds the thumb keys.  Define
+ * `adaptive_tap_hold_hand` for other matrices.
+ *
+ * Instant taps never reach `process_record`; with `TRACE_ENABLE`, they are
+ * recorded as trace actions.
+ */
+
+#ifndef ADAPTIVE_TAP_HOLD_STREAK_MS
+/** \brief Maximum time after a typed key during which tap-hold keys are taps. */
+#    define ADAPTIVE_TAP_HOLD_STREAK_MS 150
+#endif // ADAPTIVE_TAP_HOLD_STREAK_MS
+
+#ifndef ADAPTIVE_TAP_HOLD_MARGIN_MS
+/** \brief Learned tapping terms are this much longer than the average tap. */
+#    define ADAPTIVE_TAP_HOLD_MARGIN_MS 80
+#endif // ADAPTIVE_TAP_HOLD_MARGIN_MS
+
+#ifndef ADAPTIVE_TAP_HOLD_MIN_TERM
+/** \brief Shortest learned tapping term. */
+#    define ADAPTIVE_TAP_HOLD_MIN_TERM 120
+#endif // ADAPTIVE_TAP_HOLD_MIN_TERM
+
+#ifndef ADAPTIVE_TAP_HOLD_MAX_TERM
+/** \brief Longest learned tapping term. */
+#    define ADAPTIVE_TAP_HOLD_MAX_TERM TAPPING_TERM
+#endif // ADAPTIVE_TAP_HOLD_MAX_TERM
+
+#ifndef ADAPTIVE_TAP_HOLD_MAX_KEYS
+/** \brief Number of tap-hold keys whose tapping term is learned. */
+#    define ADAPTIVE_TAP_HOLD_MAX_KEYS 16
+#endif // ADAPTIVE_TAP_HOLD_MAX_KEYS
+
+#ifndef ADAPTIVE_TAP_HOLD_MAX_INSTANT
+/** \brief Number of instant taps held down at the same time. */
+#    define ADAPTIVE_TAP_HOLD_MAX_INSTANT 4
+#endif // ADAPTIVE_TAP_HOLD_MAX_INSTANT
+
+typedef enum {
+    ADAPTIVE_HAND_LEFT        = 0,
+    ADAPTIVE_HAND_RIGHT       = 1,
+    ADAPTIVE_HAND_THUMB       = 2, // ORed with the side.
+    ADAPTIVE_HAND_LEFT_THUMB  = ADAPTIVE_HAND_LEFT | ADAPTIVE_HAND_THUMB,
+    ADAPTIVE_HAND_RIGHT_THUMB = ADAPTIVE_HAND_RIGHT | ADAPTIVE_HAND_THUMB,
+} adaptive_hand_t;
+
+/** \brief Return the hand a key belongs to.  Weak, can be redefined by the keymap. */
+adaptive_hand_t adaptive_tap_hold_hand(keypos_t key);
+
+bool process_adaptive_tap_hold(uint16_t keycode, keyrecord_t *record);
+void adaptive_tap_hold_record(uint16_t keycode, keyrecord_t *record);
@@ -0,0 +1,46 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdlib.h>
+#include "auto_pointer.h"
+#include "quantum.h"
+#include "scheduler.h"
+
+#ifdef AUTO_POINTER_ENABLE
+static void auto_pointer_timeout(void) {
+    layer_off(auto_pointer_layer);
+#    if defined(AUTO_POINTER_RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_ENABLE) && !defined(RGB_INDICATOR_ENABLE)
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_DEFAULT_MODE);
+#    endif // AUTO_POINTER_RGB_MATRIX_ENABLE && RGB_MATRIX_ENABLE && !RGB_INDICATOR_ENABLE
+}
+
+static scheduler_timer_t auto_pointer_timer = SCHEDULER_TIMER(auto_pointer_timeout);
+
+report_mouse_t auto_pointer_pointing_device_task(report_mouse_t mouse_report) {
+    if (abs(mouse_report.x) <= AUTO_POINTER_THRESHOLD && abs(mouse_report.y) <= AUTO_POINTER_THRESHOLD) {
+        return mouse_report;
+    }
+    if (!scheduler_is_armed(&auto_pointer_timer)) {
+        layer_on(auto_pointer_layer);
+#    if defined(AUTO_POINTER_RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_ENABLE) && !defined(RGB_INDICATOR_ENABLE)
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_NONE);
+        rgb_matrix_sethsv_noeeprom(HSV_GREEN);
+#    endif // AUTO_POINTER_RGB_MATRIX_ENABLE && RGB_MATRIX_ENABLE && !RGB_INDICATOR_ENABLE
+    }
+    scheduler_arm(&auto_pointer_timer, AUTO_POINTER_TIMEOUT_MS);
+    return mouse_report;
+}
+#endif // AUTO_POINTER_ENABLE
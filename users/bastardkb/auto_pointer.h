@@ -0,0 +1,73 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <stdint.h>
+#include "report.h"
+
+/*
+ * Pointer layer triggered by the pointing device.
+ *
+ * Moving the pointing device by more than `AUTO_POINTER_THRESHOLD` counts in
+ * a report turns the keymap's `auto_pointer_layer` on, and it is turned off
+ * again `AUTO_POINTER_TIMEOUT_MS` after the last such report.  With
+ * `AUTO_POINTER_RGB_MATRIX_ENABLE` and without the layer indicators, the RGB
+ * matrix turns green while the layer is on.
+ *
+ * Enabled with the keyboards' own `CHARYBDIS_AUTO_POINTER_LAYER_TRIGGER_*` or
+ * `DILEMMA_AUTO_POINTER_LAYER_TRIGGER_*` defines, which set the defaults of
+ * the defines below.  The timeout is a scheduler timer, so nothing is polled
+ * while the layer is off.
+ */
+
+#if defined(CHARYBDIS_AUTO_POINTER_LAYER_TRIGGER_ENABLE) || defined(DILEMMA_AUTO_POINTER_LAYER_TRIGGER_ENABLE)
+#    define AUTO_POINTER_ENABLE
+#endif // CHARYBDIS_AUTO_POINTER_LAYER_TRIGGER_ENABLE || DILEMMA_AUTO_POINTER_LAYER_TRIGGER_ENABLE
+
+#ifdef AUTO_POINTER_ENABLE
+#    ifndef AUTO_POINTER_TIMEOUT_MS
+/** \brief Time after the last motion at which the layer is turned off. */
+#        if defined(CHARYBDIS_AUTO_POINTER_LAYER_TRIGGER_TIMEOUT_MS)
+#            define AUTO_POINTER_TIMEOUT_MS CHARYBDIS_AUTO_POINTER_LAYER_TRIGGER_TIMEOUT_MS
+#        elif defined(DILEMMA_AUTO_POINTER_LAYER_TRIGGER_TIMEOUT_MS)
+#            define AUTO_POINTER_TIMEOUT_MS DILEMMA_AUTO_POINTER_LAYER_TRIGGER_TIMEOUT_MS
+#        else
+#            define AUTO_POINTER_TIMEOUT_MS 1000
+#        endif
+#    endif // AUTO_POINTER_TIMEOUT_MS
+
+#    ifndef AUTO_POINTER_THRESHOLD
+/** \brief Motion along either axis, in counts per report, that triggers the layer. */
+#        if defined(CHARYBDIS_AUTO_POINTER_LAYER_TRIGGER_THRESHOLD)
+#            define AUTO_POINTER_THRESHOLD CHARYBDIS_AUTO_POINTER_LAYER_TRIGGER_THRESHOLD
+#        elif defined(DILEMMA_AUTO_POINTER_LAYER_TRIGGER_THRESHOLD)
+#            define AUTO_POINTER_THRESHOLD DILEMMA_AUTO_POINTER_LAYER_TRIGGER_THRESHOLD
+#        else
+#            define AUTO_POINTER_THRESHOLD 8
+#        endif
+#    endif // AUTO_POINTER_THRESHOLD
+
+#    if defined(CHARYBDIS_AUTO_POINTER_LAYER_TRIGGER_ENABLE) && !defined(AUTO_POINTER_RGB_MATRIX_ENABLE)
+/** \brief Turn the RGB matrix green while the layer is on, as the Charybdis keymaps always did. */
+#        define AUTO_POINTER_RGB_MATRIX_ENABLE
+#    endif // CHARYBDIS_AUTO_POINTER_LAYER_TRIGGER_ENABLE && !AUTO_POINTER_RGB_MATRIX_ENABLE
+
+/** \brief Layer turned on by motion, defined by the keymap. */
+extern const uint8_t auto_pointer_layer;
+
+report_mouse_t auto_pointer_pointing_device_task(report_mouse_t mouse_report);
+#endif // AUTO_POINTER_ENABLE
@@ -0,0 +1,247 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "bastardkb.h"
+
+#if defined(RAW_ENABLE) && !defined(VIA_ENABLE)
+#    include "raw_hid.h"
+#endif // RAW_ENABLE && !VIA_ENABLE
+
+__attribute__((weak)) void keyboard_post_init_keymap(void) {}
+
+__attribute__((weak)) void matrix_scan_keymap(void) {}
+
+__attribute__((weak)) void housekeeping_task_keymap(void) {}
+
+__attribute__((weak)) void suspend_power_down_keymap(void) {}
+
+__attribute__((weak)) void suspend_wakeup_init_keymap(void) {}
+
+__attribute__((weak)) bool pre_process_record_keymap(uint16_t keycode, keyrecord_t *record) {
+    return true;
+}
+
+__attribute__((weak)) bool process_record_keymap(uint16_t keycode, keyrecord_t *record) {
+    return true;
+}
+
+__attribute__((weak)) void post_process_record_keymap(uint16_t keycode, keyrecord_t *record) {}
+
+__attribute__((weak)) layer_state_t layer_state_set_keymap(layer_state_t state) {
+    return state;
+}
+
+#ifdef POINTING_DEVICE_ENABLE
+__attribute__((weak)) report_mouse_t pointing_device_task_keymap(report_mouse_t mouse_report) {
+    return mouse_report;
+}
+#endif // POINTING_DEVICE_ENABLE
+
+#ifdef RAW_ENABLE
+__attribute__((weak)) void raw_hid_receive_keymap(uint8_t *data, uint8_t length) {}
+#endif // RAW_ENABLE
+
+void keyboard_post_init_user(void) {
+#ifdef HOOK_PROFILER_ENABLE
+    hook_profiler_init();
+#endif // HOOK_PROFILER_ENABLE
+#ifdef INDEXED_COMBO_ENABLE
+    indexed_combos_init();
+#endif // INDEXED_COMBO_ENABLE
+#ifdef RGB_INDICATOR_ENABLE
+    rgb_indicator_init();
+#endif // RGB_INDICATOR_ENABLE
+#ifdef SPLIT_SYNC_ENABLE
+    split_sync_init();
+#endif // SPLIT_SYNC_ENABLE
+    keyboard_post_init_keymap();
+}
+
+void suspend_power_down_user(void) {
+#ifdef RGB_INDICATOR_ENABLE
+    rgb_indicator_suspend();
+#endif // RGB_INDICATOR_ENABLE
+    suspend_power_down_keymap();
+}
+
+void suspend_wakeup_init_user(void) {
+#ifdef RGB_INDICATOR_ENABLE
+    rgb_indicator_wakeup();
+#endif // RGB_INDICATOR_ENABLE
+    suspend_wakeup_init_keymap();
+}
+
+void matrix_scan_user(void) {
+    hook_profiler_start_t start = hook_profiler_begin();
+    matrix_scan_keymap();
+    hook_profiler_end(HOOK_MATRIX_SCAN, start);
+#ifdef HOOK_PROFILER_ENABLE
+    hook_profiler_scan();
+#endif // HOOK_PROFILER_ENABLE
+}
+
+void housekeeping_task_user(void) {
+    hook_profiler_start_t start = hook_profiler_begin();
+    scheduler_task();
+#ifdef LATENCY_STATS_ENABLE
+    latency_task();
+#endif // LATENCY_STATS_ENABLE
+#ifdef INDEXED_COMBO_ENABLE
+    indexed_combos_task();
+#endif // INDEXED_COMBO_ENABLE
+#ifdef ENCODER_BATCH_ENABLE
+    encoder_batch_task();
+#endif // ENCODER_BATCH_ENABLE
+#ifdef RGB_INDICATOR_ENABLE
+    rgb_indicator_task();
+#endif // RGB_INDICATOR_ENABLE
+#if defined(SPARSE_KEYMAP_ENABLE) && defined(SPARSE_KEYMAP_BENCHMARK)
+    sparse_keymap_benchmark_task();
+#endif // SPARSE_KEYMAP_ENABLE && SPARSE_KEYMAP_BENCHMARK
+    housekeeping_task_keymap();
+#ifdef SPLIT_SYNC_ENABLE
+    // Last, to send the changes made during this iteration right away.
+    split_sync_task();
+#endif // SPLIT_SYNC_ENABLE
+    hook_profiler_end(HOOK_HOUSEKEEPING_TASK, start);
+#ifdef HOOK_PROFILER_ENABLE
+    hook_profiler_task();
+#endif // HOOK_PROFILER_ENABLE
+}
+
+static bool pre_process_record_userspace(uint16_t keycode, keyrecord_t *record) {
+#ifdef TRACE_ENABLE
+    // First, to see the events swallowed below.
+#    ifdef INDEXED_COMBO_ENABLE
+    // Presses replayed by the combo engine were recorded when they happened.
+    if (!indexed_combos_replaying()) {
+        trace_event(record);
+    }
+#    else
+    trace_event(record);
+#    endif // INDEXED_COMBO_ENABLE
+#endif // TRACE_ENABLE
+    if (!pre_process_record_keymap(keycode, record)) {
+        return false;
+    }
+#ifdef ENCODER_BATCH_ENABLE
+    if (!process_encoder_batch(keycode, record)) {
+        return false;
+    }
+#endif // ENCODER_BATCH_ENABLE
+#ifdef INDEXED_COMBO_ENABLE
+    if (!process_indexed_combos(keycode, record)) {
+        return false;
+    }
+#endif // INDEXED_COMBO_ENABLE
+#ifdef ADAPTIVE_TAP_HOLD_ENABLE
+    // After combos, which hold back and replay key presses.
+    if (!process_adaptive_tap_hold(keycode, record)) {
+        return false;
+    }
+#endif // ADAPTIVE_TAP_HOLD_ENABLE
+    return true;
+}
+
+bool pre_process_record_user(uint16_t keycode, keyrecord_t *record) {
+    hook_profiler_start_t start  = hook_profiler_begin();
+    bool                  result = pre_process_record_userspace(keycode, record);
+    hook_profiler_end(HOOK_PRE_PROCESS_RECORD, start);
+    return result;
+}
+
+bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+    hook_profiler_start_t start = hook_profiler_begin();
+#ifdef TRACE_ENABLE
+    trace_process(keycode, record);
+#endif // TRACE_ENABLE
+#ifdef ADAPTIVE_TAP_HOLD_ENABLE
+    adaptive_tap_hold_record(keycode, record);
+#endif // ADAPTIVE_TAP_HOLD_ENABLE
+#ifdef LATENCY_STATS_ENABLE
+    latency_record_begin(record);
+#endif // LATENCY_STATS_ENABLE
+    bool result = process_record_keymap(keycode, record);
+#ifdef DRAG_SCROLL_ENABLE
+    // Before the keyboard's own drag-scroll handling, which it replaces.
+    result = result && process_drag_scroll(keycode, record);
+#endif // DRAG_SCROLL_ENABLE
+#ifdef LATENCY_STATS_ENABLE
+    if (!result) {
+        latency_record_end();
+    }
+#endif // LATENCY_STATS_ENABLE
+    hook_profiler_end(HOOK_PROCESS_RECORD, start);
+    return result;
+}
+
+void post_process_record_user(uint16_t keycode, keyrecord_t *record) {
+    post_process_record_keymap(keycode, record);
+#ifdef LATENCY_STATS_ENABLE
+    latency_record_end();
+#endif // LATENCY_STATS_ENABLE
+}
+
+layer_state_t layer_state_set_user(layer_state_t state) {
+    hook_profiler_start_t start = hook_profiler_begin();
+    state                       = layer_state_set_keymap(state);
+    hook_profiler_end(HOOK_LAYER_STATE_SET, start);
+    return state;
+}
+
+#ifdef POINTING_DEVICE_ENABLE
+report_mouse_t pointing_device_task_user(report_mouse_t mouse_report) {
+    hook_profiler_start_t start = hook_profiler_begin();
+    mouse_report                = pointing_device_task_keymap(mouse_report);
+#    ifdef AUTO_POINTER_ENABLE
+    mouse_report = auto_pointer_pointing_device_task(mouse_report);
+#    endif // AUTO_POINTER_ENABLE
+#    ifdef DRAG_SCROLL_ENABLE
+    mouse_report = drag_scroll_pointing_device_task(mouse_report);
+#    endif // DRAG_SCROLL_ENABLE
+#    ifdef ENCODER_BATCH_ENABLE
+    mouse_report = encoder_batch_pointing_device_task(mouse_report);
+#    endif // ENCODER_BATCH_ENABLE
+#    ifdef POINTER_ACCEL_ENABLE
+    // Applied last, so that the keymap sees the sensor's counts.
+    mouse_report = pointer_accel_apply(mouse_report);
+#    endif // POINTER_ACCEL_ENABLE
+    hook_profiler_end(HOOK_POINTING_DEVICE_TASK, start);
+    return mouse_report;
+}
+#endif // POINTING_DEVICE_ENABLE
+
+#if defined(RAW_ENABLE) && !defined(VIA_ENABLE)
+// With VIA enabled, VIA owns the raw HID interface.
+void raw_hid_receive(uint8_t *data, uint8_t length) {
+    switch (data[0]) {
+#    ifdef HOOK_PROFILER_ENABLE
+        case RAW_HID_HOOK_PROFILER:
+            hook_profiler_raw_hid(data, length);
+            break;
+#    endif // HOOK_PROFILER_ENABLE
+#    ifdef TRACE_ENABLE
+        case RAW_HID_TRACE:
+            trace_raw_hid(data, length);
+            break;
+#    endif // TRACE_ENABLE
+        default:
+            raw_hid_receive_keymap(data, length);
+            return;
+    }
+    raw_hid_send(data, length);
+}
+#endif // RAW_ENABLE && !VIA_ENABLE
@@ -0,0 +1,85 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+#include "hook_profiler.h"
+#include "scheduler.h"
+#ifdef POINTING_DEVICE_ENABLE
+#    include "auto_pointer.h"
+#endif // POINTING_DEVICE_ENABLE
+#ifdef LATENCY_STATS_ENABLE
+#    include "latency.h"
+#endif // LATENCY_STATS_ENABLE
+#ifdef INDEXED_COMBO_ENABLE
+#    include "indexed_combos.h"
+#endif // INDEXED_COMBO_ENABLE
+#ifdef POINTER_ACCEL_ENABLE
+#    include "pointer_accel.h"
+#endif // POINTER_ACCEL_ENABLE
+#ifdef BURST_MACRO_ENABLE
+#    include "burst_macro.h"
+#endif // BURST_MACRO_ENABLE
+#ifdef RGB_INDICATOR_ENABLE
+#    include "rgb_indicator.h"
+#endif // RGB_INDICATOR_ENABLE
+#ifdef SPLIT_SYNC_ENABLE
+#    include "split_sync.h"
+#endif // SPLIT_SYNC_ENABLE
+#ifdef SPARSE_KEYMAP_ENABLE
+#    include "sparse_keymap.h"
+#endif // SPARSE_KEYMAP_ENABLE
+#ifdef ENCODER_BATCH_ENABLE
+#    include "encoder_batch.h"
+#endif // ENCODER_BATCH_ENABLE
+#ifdef TRACE_ENABLE
+#    include "trace.h"
+#endif // TRACE_ENABLE
+#ifdef ADAPTIVE_TAP_HOLD_ENABLE
+#    include "adaptive_tap_hold.h"
+#endif // ADAPTIVE_TAP_HOLD_ENABLE
+#ifdef DRAG_SCROLL_ENABLE
+#    include "drag_scroll.h"
+#endif // DRAG_SCROLL_ENABLE
+
+/*
+ * The userspace owns the `*_user` callbacks and forwards them to the keymap.
+ * Keymaps built against it implement the `*_keymap` variants below instead.
+ */
+
+void          keyboard_post_init_keymap(void);
+void          matrix_scan_keymap(void);
+void          housekeeping_task_keymap(void);
+void          suspend_power_down_keymap(void);
+void          suspend_wakeup_init_keymap(void);
+bool          pre_process_record_keymap(uint16_t keycode, keyrecord_t *record);
+bool          process_record_keymap(uint16_t keycode, keyrecord_t *record);
+void          post_process_record_keymap(uint16_t keycode, keyrecord_t *record);
+layer_state_t layer_state_set_keymap(layer_state_t state);
+#ifdef POINTING_DEVICE_ENABLE
+report_mouse_t pointing_device_task_keymap(report_mouse_t mouse_report);
+#endif // POINTING_DEVICE_ENABLE
+#ifdef RAW_ENABLE
+void raw_hid_receive_keymap(uint8_t *data, uint8_t length);
+#endif // RAW_ENABLE
+
+/** \brief Raw HID commands handled by the userspace, sent as the first byte of a report. */
+enum userspace_raw_hid_command {
+    RAW_HID_HOOK_PROFILER = 0xB0,
+    RAW_HID_TRACE         = 0xB1,
+};
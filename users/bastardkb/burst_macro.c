@@ -0,0 +1,152 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "burst_macro.h"
+#include "action.h"
+#include "action_util.h"
+#include "send_string.h"
+#include "wait.h"
+
+/** \brief Keys of the report being built, all sharing `burst_group_mods`. */
+static uint8_t burst_group[BURST_MACRO_MAX_KEYS];
+static uint8_t burst_group_size = 0;
+static uint8_t burst_group_mods = 0;
+/** \brief Modifiers currently held by the macro. */
+static uint8_t burst_held_mods = 0;
+/**
+ * \brief Whether keys were released without sending a report yet.
+ *
+ * The release is sent along with the next modifier change when there is one,
+ * which saves a report.
+ */
+static bool burst_release_pending = false;
+
+static void burst_send_report(void) {
+    send_keyboard_report();
+    burst_release_pending = false;
+#if BURST_MACRO_DELAY > 0
+    wait_ms(BURST_MACRO_DELAY);
+#endif // BURST_MACRO_DELAY > 0
+}
+
+static void burst_set_mods(uint8_t mods) {
+    if (mods == burst_held_mods) {
+        return;
+    }
+    del_weak_mods(burst_held_mods);
+    add_weak_mods(mods);
+    burst_held_mods = mods;
+    burst_send_report();
+}
+
+/** \brief Press and release the keys of the current group. */
+static void burst_flush(void) {
+    if (burst_group_size == 0) {
+        return;
+    }
+    burst_set_mods(burst_group_mods);
+    if (burst_release_pending) {
+        burst_send_report();
+    }
+    for (uint8_t i = 0; i < burst_group_size; ++i) {
+        add_key(burst_group[i]);
+    }
+    burst_send_report();
+    for (uint8_t i = 0; i < burst_group_size; ++i) {
+        del_key(burst_group[i]);
+    }
+    burst_release_pending = true;
+    burst_group_size      = 0;
+}
+
+static void burst_end(void) {
+    burst_flush();
+    burst_set_mods(0);
+    if (burst_release_pending) {
+        burst_send_report();
+    }
+}
+
+/**
+ * \brief Add a basic keycode to the sequence.
+ *
+ * \param mods 8-bit modifiers to hold while the key is pressed.
+ */
+static void burst_queue(uint8_t keycode, uint8_t mods, bool dead) {
+    if (keycode == KC_NO) {
+        return;
+    }
+    if (IS_MODIFIER_KEYCODE(keycode)) {
+        // A modifier on its own is tapped.
+        burst_end();
+        burst_set_mods(MOD_BIT(keycode));
+        burst_set_mods(0);
+        return;
+    }
+    if (burst_group_size > 0 && (mods != burst_group_mods || keycode <= burst_group[burst_group_size - 1] || burst_group_size == BURST_MACRO_MAX_KEYS)) {
+        burst_flush();
+    }
+    burst_group_mods               = mods;
+    burst_group[burst_group_size++] = keycode;
+    if (dead) {
+        // The space must follow the release of the dead key.
+        burst_flush();
+        burst_queue(KC_SPACE, 0, false);
+    }
+}
+
+void send_burst_string(const char *string) {
+    char ascii_code;
+    while ((ascii_code = *string++) != '\0') {
+        if ((uint8_t)ascii_code >= 128) {
+            continue;
+        }
+        uint8_t keycode = pgm_read_byte(&ascii_to_keycode_lut[(uint8_t)ascii_code]);
+        uint8_t mods    = 0;
+        if (PGM_LOADBIT(ascii_to_shift_lut, (uint8_t)ascii_code)) {
+            mods |= MOD_BIT(KC_LEFT_SHIFT);
+        }
+        if (PGM_LOADBIT(ascii_to_altgr_lut, (uint8_t)ascii_code)) {
+            mods |= MOD_BIT(KC_RIGHT_ALT);
+        }
+        burst_queue(keycode, mods, PGM_LOADBIT(ascii_to_dead_lut, (uint8_t)ascii_code));
+    }
+    burst_end();
+}
+
+/** \brief Whether `keycode` is a usage of the keyboard report, which can be batched. */
+static bool burst_is_keyboard_usage(uint8_t keycode) {
+    return IS_BASIC_KEYCODE(keycode) || IS_MODIFIER_KEYCODE(keycode);
+}
+
+void send_burst_keycodes_P(const uint16_t *keycodes, uint8_t count) {
+    for (uint8_t i = 0; i < count; ++i) {
+        uint16_t keycode = pgm_read_word(&keycodes[i]);
+        if (IS_QK_BASIC(keycode) && burst_is_keyboard_usage(keycode)) {
+            burst_queue(keycode, 0, false);
+        } else if (IS_QK_MODS(keycode) && burst_is_keyboard_usage(QK_MODS_GET_BASIC_KEYCODE(keycode))) {
+            // Convert the 5-bit modifiers of the keycode to 8-bit, as `register_code16` does.
+            uint8_t mods = QK_MODS_GET_MODS(keycode);
+            burst_queue(QK_MODS_GET_BASIC_KEYCODE(keycode), (mods & 0x10) ? (mods & 0x0F) << 4 : mods, false);
+        } else {
+            // Consumer, system and mouse keycodes are not in the keyboard
+            // report: tap them on their own.
+            burst_end();
+            tap_code16(keycode);
+        }
+    }
+    burst_end();
+}
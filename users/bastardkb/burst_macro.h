@@ -0,0 +1,64 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <stdint.h>
+#include "progmem.h"
+
+/*
+ * Burst macros.
+ *
+ * `SEND_STRING` taps every character on its own: one report to press the key
+ * and one to release it, plus one for each modifier press and release.  This
+ * engine presses as many keys as possible in a single report instead, and
+ * keeps modifiers held across consecutive keys that need them.
+ *
+ * Keys are only pressed together if they can't be reordered by the host:
+ * within a report they must have the same modifiers and strictly increasing
+ * keycodes (the order of the NKRO bitmap).  Modifiers are always pressed in a
+ * report of their own, before the keys they apply to.  Dead keys are
+ * followed by a space, like `SEND_STRING` does.
+ */
+
+#ifndef BURST_MACRO_MAX_KEYS
+/** \brief Maximum number of keys pressed in a single report. */
+#    define BURST_MACRO_MAX_KEYS 6
+#endif // BURST_MACRO_MAX_KEYS
+
+#ifndef BURST_MACRO_DELAY
+/** \brief Delay between reports, in milliseconds. */
+#    define BURST_MACRO_DELAY TAP_CODE_DELAY
+#endif // BURST_MACRO_DELAY
+
+/**
+ * \brief Type an ASCII string.
+ *
+ * Uses the same lookup tables as `SEND_STRING`, so include the matching
+ * `sendstring_*.h` header for non-US host layouts.  `SS_TAP`/`SS_DOWN`/`SS_UP`
+ * sequences are not supported.
+ */
+void send_burst_string(const char *string);
+
+/** \brief Type a sequence of keycodes stored in PROGMEM, eg. `DE_AT` or `LSFT(KC_A)`. */
+void send_burst_keycodes_P(const uint16_t *keycodes, uint8_t count);
+
+/** \brief Type a sequence of keycodes, eg. `SEND_BURST(KC_Q, KC_U)`. */
+#define SEND_BURST(...)                                                                     \
+    do {                                                                                    \
+        static const uint16_t PROGMEM burst_keycodes_[] = {__VA_ARGS__};                    \
+        send_burst_keycodes_P(burst_keycodes_, sizeof(burst_keycodes_) / sizeof(uint16_t)); \
+    } while (0)
@@ -0,0 +1,31 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#ifdef SPLIT_SYNC_ENABLE
+#    ifndef SPLIT_TRANSACTION_IDS_USER
+// Keymaps defining their own transactions must add `USERSPACE_SPLIT_SYNC` to
+// their list.
+#        define SPLIT_TRANSACTION_IDS_USER USERSPACE_SPLIT_SYNC
+#    endif // SPLIT_TRANSACTION_IDS_USER
+#endif     // SPLIT_SYNC_ENABLE
+
+#ifdef ADAPTIVE_TAP_HOLD_ENABLE
+// The userspace decides the tapping term and hold on other key press per key.
+#    define TAPPING_TERM_PER_KEY
+#    define HOLD_ON_OTHER_KEY_PRESS_PER_KEY
+#endif // ADAPTIVE_TAP_HOLD_ENABLE
@@ -0,0 +1,166 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdlib.h>
+#include "drag_scroll.h"
+#include "scheduler.h"
+
+#ifdef WHEEL_EXTENDED_REPORT
+#    define DRAG_SCROLL_HV_MAX INT16_MAX
+#else
+#    define DRAG_SCROLL_HV_MAX INT8_MAX
+#endif // WHEEL_EXTENDED_REPORT
+
+typedef enum {
+    DRAG_SCROLL_AXIS_NONE,
+    DRAG_SCROLL_AXIS_H,
+    DRAG_SCROLL_AXIS_V,
+} drag_scroll_axis_t;
+
+static bool drag_scroll_enabled = false;
+
+/** \brief Accumulated wheel motion, in wheel units times `DRAG_SCROLL_COUNTS_PER_STEP`. */
+static int32_t drag_scroll_h = 0;
+static int32_t drag_scroll_v = 0;
+
+static drag_scroll_axis_t drag_scroll_axis = DRAG_SCROLL_AXIS_NONE;
+/** \brief Motion along each axis since the axis was unlocked, in counts. */
+static uint16_t drag_scroll_motion_x = 0;
+static uint16_t drag_scroll_motion_y = 0;
+
+static void drag_scroll_unlock(void) {
+    drag_scroll_axis     = DRAG_SCROLL_AXIS_NONE;
+    drag_scroll_motion_x = 0;
+    drag_scroll_motion_y = 0;
+}
+
+/** \brief Armed while the pointer moves, unlocks the axis when it expires. */
+static scheduler_timer_t drag_scroll_rest_timer = SCHEDULER_TIMER(drag_scroll_unlock);
+/** \brief Armed after each wheel report, until the next one can be sent. */
+static scheduler_timer_t drag_scroll_interval_timer = SCHEDULER_TIMER(NULL);
+
+void drag_scroll_set_enabled(bool enabled) {
+    if (enabled == drag_scroll_enabled) {
+        return;
+    }
+    drag_scroll_enabled = enabled;
+    drag_scroll_h       = 0;
+    drag_scroll_v       = 0;
+    drag_scroll_unlock();
+    scheduler_cancel(&drag_scroll_rest_timer);
+    scheduler_cancel(&drag_scroll_interval_timer);
+}
+
+bool drag_scroll_is_enabled(void) {
+    return drag_scroll_enabled;
+}
+
+bool process_drag_scroll(uint16_t keycode, keyrecord_t *record) {
+    switch (keycode) {
+        case DRAGSCROLL_MODE:
+            drag_scroll_set_enabled(record->event.pressed);
+            return false;
+        case DRAGSCROLL_MODE_TOGGLE:
+            if (record->event.pressed) {
+                drag_scroll_set_enabled(!drag_scroll_enabled);
+            }
+            return false;
+        default:
+            return true;
+    }
+}
+
+/** \brief Return the number of wheel units per wheel step. */
+static int16_t drag_scroll_resolution(void) {
+#ifdef POINTING_DEVICE_HIRES_SCROLL_ENABLE
+    return pointing_device_get_hires_scroll_resolution();
+#else
+    return 1;
+#endif // POINTING_DEVICE_HIRES_SCROLL_ENABLE
+}
+
+/** \brief Lock the axis with the most motion once the pointer moved far enough. */
+static void drag_scroll_lock(int16_t x, int16_t y) {
+    if (drag_scroll_axis != DRAG_SCROLL_AXIS_NONE) {
+        return;
+    }
+    drag_scroll_motion_x += abs(x);
+    drag_scroll_motion_y += abs(y);
+    if (drag_scroll_motion_x + drag_scroll_motion_y < DRAG_SCROLL_AXIS_LOCK_THRESHOLD) {
+        return;
+    }
+    // The motion along the other axis so far is dropped.
+    if (drag_scroll_motion_x >= drag_scroll_motion_y) {
+        drag_scroll_axis = DRAG_SCROLL_AXIS_H;
+        drag_scroll_v    = 0;
+    } else {
+        drag_scroll_axis = DRAG_SCROLL_AXIS_V;
+        drag_scroll_h    = 0;
+    }
+}
+
+/** \brief Add the whole wheel units of `accumulated` that fit in a report field, keeping the rest. */
+static mouse_hv_report_t drag_scroll_take(mouse_hv_report_t value, int32_t *accumulated) {
+    int32_t sum = (int32_t)value + *accumulated / DRAG_SCROLL_COUNTS_PER_STEP;
+    if (sum > DRAG_SCROLL_HV_MAX) {
+        sum = DRAG_SCROLL_HV_MAX;
+    } else if (sum < -DRAG_SCROLL_HV_MAX) {
+        sum = -DRAG_SCROLL_HV_MAX;
+    }
+    *accumulated -= (sum - value) * DRAG_SCROLL_COUNTS_PER_STEP;
+    return sum;
+}
+
+report_mouse_t drag_scroll_pointing_device_task(report_mouse_t mouse_report) {
+    if (!drag_scroll_enabled) {
+        return mouse_report;
+    }
+#ifdef DRAG_SCROLL_REVERSE_X
+    int16_t x = -mouse_report.x;
+#else
+    int16_t x = mouse_report.x;
+#endif // DRAG_SCROLL_REVERSE_X
+#ifdef DRAG_SCROLL_REVERSE_Y
+    int16_t y = -mouse_report.y;
+#else
+    int16_t y = mouse_report.y;
+#endif // DRAG_SCROLL_REVERSE_Y
+    mouse_report.x = 0;
+    mouse_report.y = 0;
+
+    if (x != 0 || y != 0) {
+        int16_t resolution = drag_scroll_resolution();
+        if (drag_scroll_axis != DRAG_SCROLL_AXIS_V) {
+            drag_scroll_h += (int32_t)x * resolution;
+        }
+        if (drag_scroll_axis != DRAG_SCROLL_AXIS_H) {
+            drag_scroll_v += (int32_t)y * resolution;
+        }
+        drag_scroll_lock(x, y);
+        scheduler_arm(&drag_scroll_rest_timer, DRAG_SCROLL_AXIS_LOCK_MS);
+    }
+    if (drag_scroll_axis == DRAG_SCROLL_AXIS_NONE || scheduler_is_armed(&drag_scroll_interval_timer)) {
+        return mouse_report;
+    }
+    mouse_hv_report_t h = mouse_report.h;
+    mouse_hv_report_t v = mouse_report.v;
+    mouse_report.h      = drag_scroll_take(h, &drag_scroll_h);
+    mouse_report.v      = drag_scroll_take(v, &drag_scroll_v);
+    if (mouse_report.h != h || mouse_report.v != v) {
+        scheduler_arm(&drag_scroll_interval_timer, DRAG_SCROLL_INTERVAL_MS);
+    }
+    return mouse_report;
+}
@@ -0,0 +1,78 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "quantum.h"
+
+/*
+ * High-resolution drag-scroll.
+ *
+ * Takes over the keyboards' drag-scroll keycodes (`DRGSCRL` and `DRG_TOG`):
+ * while drag-scroll is on, pointer motion is turned into wheel motion.
+ *
+ * - Motion is accumulated in fixed point, in wheel units times
+ *   `DRAG_SCROLL_COUNTS_PER_STEP`, so that counts short of a wheel unit are
+ *   kept for the next report instead of being dropped.
+ * - With `POINTING_DEVICE_HIRES_SCROLL_ENABLE`, wheel units are fractions of
+ *   a step, at the resolution advertised to the host.
+ * - Scrolling is locked to the axis that moved first, until the pointer has
+ *   been still for `DRAG_SCROLL_AXIS_LOCK_MS`.
+ * - Wheel motion is sent at most once every `DRAG_SCROLL_INTERVAL_MS`, the
+ *   motion in between is merged into the next report.
+ */
+
+#ifndef DRAG_SCROLL_COUNTS_PER_STEP
+/** \brief Pointer motion, in counts, scrolling one wheel step. */
+#    define DRAG_SCROLL_COUNTS_PER_STEP 24
+#endif // DRAG_SCROLL_COUNTS_PER_STEP
+
+#ifndef DRAG_SCROLL_INTERVAL_MS
+/** \brief Minimum time between two wheel reports, one per USB poll by default. */
+#    ifdef USB_POLLING_INTERVAL_MS
+#        define DRAG_SCROLL_INTERVAL_MS USB_POLLING_INTERVAL_MS
+#    else
+// QMK's default, set in `usb_descriptor.h`, which is not included here.
+#        define DRAG_SCROLL_INTERVAL_MS 1
+#    endif // USB_POLLING_INTERVAL_MS
+#endif // DRAG_SCROLL_INTERVAL_MS
+
+#ifndef DRAG_SCROLL_AXIS_LOCK_THRESHOLD
+/** \brief Motion, in counts, after which the axis with the most motion is locked. */
+#    define DRAG_SCROLL_AXIS_LOCK_THRESHOLD 4
+#endif // DRAG_SCROLL_AXIS_LOCK_THRESHOLD
+
+#ifndef DRAG_SCROLL_AXIS_LOCK_MS
+/** \brief Time without motion after which the axis is unlocked. */
+#    define DRAG_SCROLL_AXIS_LOCK_MS 300
+#endif // DRAG_SCROLL_AXIS_LOCK_MS
+
+#if defined(CHARYBDIS_DRAGSCROLL_REVERSE_X) || defined(DILEMMA_DRAGSCROLL_REVERSE_X)
+#    define DRAG_SCROLL_REVERSE_X
+#endif // CHARYBDIS_DRAGSCROLL_REVERSE_X || DILEMMA_DRAGSCROLL_REVERSE_X
+
+#if defined(CHARYBDIS_DRAGSCROLL_REVERSE_Y) || defined(DILEMMA_DRAGSCROLL_REVERSE_Y)
+#    define DRAG_SCROLL_REVERSE_Y
+#endif // CHARYBDIS_DRAGSCROLL_REVERSE_Y || DILEMMA_DRAGSCROLL_REVERSE_Y
+
+/** \brief Turn drag-scroll on or off, eg. from `layer_state_set_keymap`. */
+void drag_scroll_set_enabled(bool enabled);
+bool drag_scroll_is_enabled(void);
+
+bool           process_drag_scroll(uint16_t keycode, keyrecord_t *record);
+report_mouse_t drag_scroll_pointing_device_task(report_mouse_t mouse_report);
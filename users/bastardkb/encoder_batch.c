@@ -0,0 +1,158 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "encoder_batch.h"
+#ifdef TRACE_ENABLE
+#    include "trace.h"
+#endif // TRACE_ENABLE
+
+#ifdef WHEEL_EXTENDED_REPORT
+#    define ENCODER_BATCH_HV_MAX INT16_MAX
+#else
+#    define ENCODER_BATCH_HV_MAX INT8_MAX
+#endif // WHEEL_EXTENDED_REPORT
+
+typedef struct {
+    uint16_t keycode;     // Keycode of the queued taps.
+    uint16_t taps;        // Number of queued taps.
+    uint16_t last_detent; // Time of the last detent.
+    uint16_t interval;    // Smoothed time between detents, in milliseconds.
+} encoder_batch_t;
+
+static encoder_batch_t encoder_batch[NUM_ENCODERS];
+static uint16_t        encoder_batch_pending_taps = 0;
+static uint16_t        encoder_batch_key_timer    = 0;
+
+#ifdef POINTING_DEVICE_ENABLE
+static int16_t  encoder_batch_wheel_v     = 0;
+static int16_t  encoder_batch_wheel_h     = 0;
+static uint16_t encoder_batch_wheel_timer = 0;
+
+/** \brief Return the number of wheel steps scrolled by a detent, from the rotation speed. */
+static int16_t encoder_batch_gain(encoder_batch_t *encoder) {
+    uint16_t now     = timer_read();
+    uint16_t elapsed = TIMER_DIFF_16(now, encoder->last_detent);
+
+    encoder->last_detent = now;
+    if (elapsed >= ENCODER_BATCH_IDLE_MS) {
+        encoder->interval = ENCODER_BATCH_IDLE_MS;
+    } else {
+        encoder->interval = (encoder->interval + elapsed) / 2;
+    }
+    uint16_t gain = ENCODER_BATCH_ACCEL_MS / (encoder->interval ? encoder->interval : 1);
+    if (gain < 1) {
+        return 1;
+    }
+    return gain > ENCODER_BATCH_MAX_GAIN ? ENCODER_BATCH_MAX_GAIN : gain;
+}
+
+/** \brief Add as much of `pending` as fits in a report field, keeping the rest pending. */
+static mouse_hv_report_t encoder_batch_wheel_take(mouse_hv_report_t value, int16_t *pending) {
+    int32_t sum = (int32_t)value + *pending;
+    if (sum > ENCODER_BATCH_HV_MAX) {
+        sum = ENCODER_BATCH_HV_MAX;
+    } else if (sum < -ENCODER_BATCH_HV_MAX) {
+        sum = -ENCODER_BATCH_HV_MAX;
+    }
+    *pending -= sum - value;
+    return sum;
+}
+
+static bool encoder_batch_wheel(encoder_batch_t *encoder, uint16_t keycode) {
+    switch (keycode) {
+        case KC_WH_U:
+            encoder_batch_wheel_v += encoder_batch_gain(encoder);
+            return true;
+        case KC_WH_D:
+            encoder_batch_wheel_v -= encoder_batch_gain(encoder);
+            return true;
+        case KC_WH_R:
+            encoder_batch_wheel_h += encoder_batch_gain(encoder);
+            return true;
+        case KC_WH_L:
+            encoder_batch_wheel_h -= encoder_batch_gain(encoder);
+            return true;
+        default:
+            return false;
+    }
+}
+
+report_mouse_t encoder_batch_pointing_device_task(report_mouse_t mouse_report) {
+    if ((encoder_batch_wheel_v == 0 && encoder_batch_wheel_h == 0) || timer_elapsed(encoder_batch_wheel_timer) < ENCODER_BATCH_WHEEL_INTERVAL_MS) {
+        return mouse_report;
+    }
+    encoder_batch_wheel_timer = timer_read();
+    mouse_report.v            = encoder_batch_wheel_take(mouse_report.v, &encoder_batch_wheel_v);
+    mouse_report.h            = encoder_batch_wheel_take(mouse_report.h, &encoder_batch_wheel_h);
+    return mouse_report;
+}
+#endif // POINTING_DEVICE_ENABLE
+
+static void encoder_batch_tap(encoder_batch_t *encoder, uint16_t taps) {
+    for (uint16_t i = 0; i < taps; ++i) {
+        tap_code16(encoder->keycode);
+#ifdef TRACE_ENABLE
+        trace_action(TRACE_NO_KEY, encoder->keycode, TRACE_TAP);
+#endif // TRACE_ENABLE
+    }
+    encoder->taps -= taps;
+    encoder_batch_pending_taps -= taps;
+}
+
+bool process_encoder_batch(uint16_t keycode, keyrecord_t *record) {
+    if (!IS_ENCODEREVENT(record->event) || record->event.key.col >= NUM_ENCODERS || keycode > QK_MODS_MAX) {
+        return true;
+    }
+    // The release of a detent follows its press right away, drop it.
+    if (!record->event.pressed) {
+        return false;
+    }
+
+    encoder_batch_t *encoder = &encoder_batch[record->event.key.col];
+#ifdef POINTING_DEVICE_ENABLE
+    if (encoder_batch_wheel(encoder, keycode)) {
+        return false;
+    }
+#endif // POINTING_DEVICE_ENABLE
+    // Changing direction or layer: send what was queued first.
+    if (encoder->taps > 0 && encoder->keycode != keycode) {
+        encoder_batch_tap(encoder, encoder->taps);
+    }
+    encoder->keycode = keycode;
+#ifdef ENCODER_BATCH_MAX_PENDING_TAPS
+    if (encoder->taps >= ENCODER_BATCH_MAX_PENDING_TAPS) {
+        return false;
+    }
+#endif // ENCODER_BATCH_MAX_PENDING_TAPS
+    // Only a stuck encoder gets that far behind, drop its detents.
+    if (encoder_batch_pending_taps == UINT16_MAX) {
+        return false;
+    }
+    ++encoder->taps;
+    ++encoder_batch_pending_taps;
+    return false;
+}
+
+void encoder_batch_task(void) {
+    if (encoder_batch_pending_taps == 0 || timer_elapsed(encoder_batch_key_timer) < ENCODER_BATCH_KEY_INTERVAL_MS) {
+        return;
+    }
+    encoder_batch_key_timer = timer_read();
+    for (uint8_t i = 0; i < NUM_ENCODERS; ++i) {
+        encoder_batch_t *encoder = &encoder_batch[i];
+        encoder_batch_tap(encoder, encoder->taps < ENCODER_BATCH_TAPS_PER_INTERVAL ? encoder->taps : ENCODER_BATCH_TAPS_PER_INTERVAL);
+    }
+}
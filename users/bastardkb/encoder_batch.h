@@ -0,0 +1,96 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "quantum.h"
+
+/*
+ * Encoder detent batching.
+ *
+ * Encoder events resolved through `encoder_map` are taken out of the regular
+ * key processing and queued per encoder:
+ *
+ * - mouse wheel keycodes are summed, scaled by the rotation speed, and sent as
+ *   a single wheel report at most every `ENCODER_BATCH_WHEEL_INTERVAL_MS`
+ *   (requires `POINTING_DEVICE_ENABLE`, otherwise they are tapped like keys);
+ * - basic and modified keycodes are tapped at most
+ *   `ENCODER_BATCH_TAPS_PER_INTERVAL` times every
+ *   `ENCODER_BATCH_KEY_INTERVAL_MS`, by default as fast as the host reads
+ *   their reports.  Every detent is tapped, unless
+ *   `ENCODER_BATCH_MAX_PENDING_TAPS` is defined: detents past that many queued
+ *   taps are then dropped, so the host never lags behind the knob.
+ *
+ * Other keycodes (eg. RGB or layer keycodes) are processed as usual.
+ */
+
+#ifndef ENCODER_BATCH_WHEEL_INTERVAL_MS
+/** \brief Minimum time between two wheel reports. */
+#    define ENCODER_BATCH_WHEEL_INTERVAL_MS 16
+#endif // ENCODER_BATCH_WHEEL_INTERVAL_MS
+
+#ifndef ENCODER_BATCH_ACCEL_MS
+/**
+ * \brief Time between detents at which a detent scrolls two wheel steps.
+ *
+ * A detent scrolls `ENCODER_BATCH_ACCEL_MS / interval` wheel steps, between 1
+ * and `ENCODER_BATCH_MAX_GAIN`.
+ */
+#    define ENCODER_BATCH_ACCEL_MS 60
+#endif // ENCODER_BATCH_ACCEL_MS
+
+#ifndef ENCODER_BATCH_MAX_GAIN
+/** \brief Maximum number of wheel steps per detent. */
+#    define ENCODER_BATCH_MAX_GAIN 4
+#endif // ENCODER_BATCH_MAX_GAIN
+
+#ifndef ENCODER_BATCH_IDLE_MS
+/** \brief Time after which the encoder is considered at rest, and the speed reset. */
+#    define ENCODER_BATCH_IDLE_MS 200
+#endif // ENCODER_BATCH_IDLE_MS
+
+#ifndef ENCODER_BATCH_TAPS_PER_INTERVAL
+/** \brief Maximum number of taps of an encoder's keycode per batch. */
+#    define ENCODER_BATCH_TAPS_PER_INTERVAL 2
+#endif // ENCODER_BATCH_TAPS_PER_INTERVAL
+
+#ifndef ENCODER_BATCH_KEY_INTERVAL_MS
+/**
+ * \brief Time between two batches of key taps.
+ *
+ * A tap is two keyboard reports, each read on a USB poll: by default, a batch
+ * is sent as soon as the host has read the previous one.
+ */
+#    ifdef USB_POLLING_INTERVAL_MS
+#        define ENCODER_BATCH_KEY_INTERVAL_MS (2 * ENCODER_BATCH_TAPS_PER_INTERVAL * USB_POLLING_INTERVAL_MS)
+#    else
+// QMK's default, set in `usb_descriptor.h`, which is not included here.
+#        define ENCODER_BATCH_KEY_INTERVAL_MS (2 * ENCODER_BATCH_TAPS_PER_INTERVAL)
+#    endif // USB_POLLING_INTERVAL_MS
+#endif // ENCODER_BATCH_KEY_INTERVAL_MS
+
+/*
+ * ENCODER_BATCH_MAX_PENDING_TAPS, unset by default: maximum number of queued
+ * taps per encoder, further detents are dropped.
+ */
+
+bool process_encoder_batch(uint16_t keycode, keyrecord_t *record);
+void encoder_batch_task(void);
+#ifdef POINTING_DEVICE_ENABLE
+report_mouse_t encoder_batch_pointing_device_task(report_mouse_t mouse_report);
+#endif // POINTING_DEVICE_ENABLE
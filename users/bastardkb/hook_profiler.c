@@ -0,0 +1,117 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <string.h>
+#include "hook_profiler.h"
+#include "print.h"
+#include "timer.h"
+
+static hook_profiler_window_t hook_profiler_current = {0};
+static hook_profiler_window_t hook_profiler_last    = {0};
+static uint32_t               hook_profiler_timer   = 0;
+
+static const char *const hook_profiler_names[HOOK_COUNT] = {
+    [HOOK_MATRIX_SCAN]          = "matrix_scan",
+    [HOOK_HOUSEKEEPING_TASK]    = "housekeeping_task",
+    [HOOK_PRE_PROCESS_RECORD]   = "pre_process_record",
+    [HOOK_PROCESS_RECORD]       = "process_record",
+    [HOOK_LAYER_STATE_SET]      = "layer_state_set",
+    [HOOK_POINTING_DEVICE_TASK] = "pointing_device_task",
+};
+
+void hook_profiler_init(void) {
+#ifdef TIMING_HAS_CYCLE_COUNTER
+    timing_cycles_init();
+#endif // TIMING_HAS_CYCLE_COUNTER
+    hook_profiler_timer = timer_read32();
+}
+
+void hook_profiler_add(hook_profiler_hook_t hook, uint32_t cost) {
+    hook_profiler_stat_t *stat = &hook_profiler_current.hooks[hook];
+    if (stat->count == 0 || cost < stat->min) {
+        stat->min = cost;
+    }
+    if (cost > stat->max) {
+        stat->max = cost;
+    }
+    stat->total += cost;
+    ++stat->count;
+}
+
+void hook_profiler_scan(void) {
+    ++hook_profiler_current.scans;
+}
+
+void hook_profiler_task(void) {
+    if (timer_elapsed32(hook_profiler_timer) < HOOK_PROFILER_INTERVAL_MS) {
+        return;
+    }
+    hook_profiler_timer   = timer_read32();
+    hook_profiler_last    = hook_profiler_current;
+    hook_profiler_current = (hook_profiler_window_t){0};
+    hook_profiler_print();
+}
+
+const hook_profiler_window_t *hook_profiler_get(void) {
+    return &hook_profiler_last;
+}
+
+void hook_profiler_print(void) {
+#ifdef TIMING_HAS_CYCLE_COUNTER
+    static const char unit[] = "cycles";
+#else
+    static const char unit[] = "us";
+#endif // TIMING_HAS_CYCLE_COUNTER
+    uprintf("profile: %lu scans in %u ms\n", hook_profiler_last.scans, HOOK_PROFILER_INTERVAL_MS);
+    for (uint8_t i = 0; i < HOOK_COUNT; ++i) {
+        const hook_profiler_stat_t *stat = &hook_profiler_last.hooks[i];
+        if (stat->count == 0) {
+            continue;
+        }
+        uprintf("profile: %s min %lu avg %lu max %lu %s (n=%lu)\n", hook_profiler_names[i], stat->min, stat->total / stat->count, stat->max, unit, stat->count);
+    }
+}
+
+static void hook_profiler_write_u32(uint8_t *data, uint32_t value) {
+    data[0] = value & 0xFF;
+    data[1] = (value >> 8) & 0xFF;
+    data[2] = (value >> 16) & 0xFF;
+    data[3] = (value >> 24) & 0xFF;
+}
+
+/**
+ * \brief Raw HID readout.
+ *
+ * Request: `[command, hook]`.  Response, little endian:
+ * `[command, hook, unit, scans:4, count:4, min:4, avg:4, max:4]`, where `unit`
+ * is 1 for CPU cycles and 0 for microseconds.  An out of range hook returns the
+ * scan count only.
+ */
+void hook_profiler_raw_hid(uint8_t *data, uint8_t length) {
+    uint8_t hook = data[1];
+    memset(&data[2], 0, length - 2);
+#ifdef TIMING_HAS_CYCLE_COUNTER
+    data[2] = 1;
+#endif // TIMING_HAS_CYCLE_COUNTER
+    hook_profiler_write_u32(&data[3], hook_profiler_last.scans);
+    if (hook < HOOK_COUNT) {
+        const hook_profiler_stat_t *stat = &hook_profiler_last.hooks[hook];
+        hook_profiler_write_u32(&data[7], stat->count);
+        hook_profiler_write_u32(&data[11], stat->min);
+        hook_profiler_write_u32(&data[15], stat->count ? stat->total / stat->count : 0);
+        hook_profiler_write_u32(&data[19], stat->max);
+    }
+}
@@ -0,0 +1,107 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <stdint.h>
+#include "timing.h"
+
+/*
+ * Userspace callback profiler.
+ *
+ * Records the min/avg/max cost of each userspace callback, and the number of
+ * matrix scans, over a window of `HOOK_PROFILER_INTERVAL_MS`.  Costs are in CPU
+ * cycles where the MCU has a cycle counter (see `TIMING_HAS_CYCLE_COUNTER`), in
+ * microseconds otherwise.
+ *
+ * When `HOOK_PROFILER_ENABLE` is not defined, `hook_profiler_begin` and
+ * `hook_profiler_end` compile to nothing.
+ */
+
+#ifndef HOOK_PROFILER_INTERVAL_MS
+/** \brief Duration of a measurement window. */
+#    define HOOK_PROFILER_INTERVAL_MS 1000
+#endif // HOOK_PROFILER_INTERVAL_MS
+
+typedef enum {
+    HOOK_MATRIX_SCAN = 0,
+    HOOK_HOUSEKEEPING_TASK,
+    HOOK_PRE_PROCESS_RECORD,
+    HOOK_PROCESS_RECORD,
+    HOOK_LAYER_STATE_SET,
+    HOOK_POINTING_DEVICE_TASK,
+    HOOK_COUNT,
+} hook_profiler_hook_t;
+
+typedef struct {
+    uint32_t count;
+    uint32_t total;
+    uint32_t min;
+    uint32_t max;
+} hook_profiler_stat_t;
+
+/** \brief Figures for one measurement window. */
+typedef struct {
+    uint32_t             scans;
+    hook_profiler_stat_t hooks[HOOK_COUNT];
+} hook_profiler_window_t;
+
+#ifdef HOOK_PROFILER_ENABLE
+#    ifdef TIMING_HAS_CYCLE_COUNTER
+typedef uint32_t hook_profiler_start_t;
+
+static inline hook_profiler_start_t hook_profiler_begin(void) {
+    return timing_cycles_read();
+}
+
+static inline uint32_t hook_profiler_elapsed(hook_profiler_start_t start) {
+    return timing_cycles_read() - start;
+}
+#    else
+typedef timing_t hook_profiler_start_t;
+
+static inline hook_profiler_start_t hook_profiler_begin(void) {
+    return timing_read();
+}
+
+static inline uint32_t hook_profiler_elapsed(hook_profiler_start_t start) {
+    return timing_elapsed_us(start);
+}
+#    endif // TIMING_HAS_CYCLE_COUNTER
+
+void hook_profiler_add(hook_profiler_hook_t hook, uint32_t cost);
+
+static inline void hook_profiler_end(hook_profiler_hook_t hook, hook_profiler_start_t start) {
+    hook_profiler_add(hook, hook_profiler_elapsed(start));
+}
+
+void hook_profiler_init(void);
+void hook_profiler_scan(void);
+void hook_profiler_task(void);
+
+/** \brief Return the figures of the last complete window. */
+const hook_profiler_window_t *hook_profiler_get(void);
+void                          hook_profiler_print(void);
+void                          hook_profiler_raw_hid(uint8_t *data, uint8_t length);
+#else
+typedef uint8_t hook_profiler_start_t;
+
+static inline hook_profiler_start_t hook_profiler_begin(void) {
+    return 0;
+}
+
+static inline void hook_profiler_end(hook_profiler_hook_t hook, hook_profiler_start_t start) {}
+#endif // HOOK_PROFILER_ENABLE
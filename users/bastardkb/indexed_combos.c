@@ -0,0 +1,304 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "indexed_combos.h"
+#include "print.h"
+#include "timer.h"
+#ifdef TRACE_ENABLE
+#    include "trace.h"
+#endif // TRACE_ENABLE
+
+/**
+ * \brief Key index entry.
+ *
+ * The index holds one entry per key of every combo, sorted by keycode.  All
+ * the combos containing a keycode are thus found with a binary search.
+ */
+typedef struct {
+    uint16_t keycode;
+    uint16_t combo;
+} combo_index_entry_t;
+
+static combo_index_entry_t combo_index[INDEXED_COMBO_MAX_KEYS];
+static uint16_t            combo_index_size = 0;
+
+/** \brief Presses held back while waiting for the rest of a combo. */
+static struct {
+    keyevent_t event;
+    uint16_t   keycode;
+} combo_buffer[INDEXED_COMBO_MAX_LENGTH];
+static uint8_t  combo_buffer_length = 0;
+static uint16_t combo_buffer_timer  = 0;
+/** \brief Combo exactly matching the buffer, fired on timeout if no longer combo completes. */
+static int16_t combo_buffer_match = -1;
+
+/** \brief Combos that fired and whose keys are still held. */
+static struct {
+    uint16_t combo;
+    uint8_t  length;
+    uint8_t  released;
+    keypos_t keys[INDEXED_COMBO_MAX_LENGTH];
+} combo_active[INDEXED_COMBO_MAX_ACTIVE];
+static uint8_t combo_active_length = 0;
+
+/** \brief Set while buffered presses are fed back into `action_exec`. */
+static bool combo_replaying = false;
+
+static uint8_t combo_length(uint16_t combo) {
+    const uint16_t *keys   = key_combos[combo].keys;
+    uint8_t         length = 0;
+    while (pgm_read_word(&keys[length]) != COMBO_END) {
+        ++length;
+    }
+    return length;
+}
+
+void indexed_combos_init(void) {
+    uint16_t keys_count = 0;
+    combo_index_size    = 0;
+    for (uint16_t combo = 0; combo < key_combos_count; ++combo) {
+        uint8_t length = combo_length(combo);
+        keys_count += length;
+        if (keys_count > INDEXED_COMBO_MAX_KEYS) {
+            // Not indexed, reported below.
+            continue;
+        }
+        const uint16_t *keys = key_combos[combo].keys;
+        for (uint8_t i = 0; i < length; ++i) {
+            uint16_t keycode = pgm_read_word(&keys[i]);
+            // Insertion sort: the index is only built once.
+            uint16_t j = combo_index_size++;
+            while (j > 0 && combo_index[j - 1].keycode > keycode) {
+                combo_index[j] = combo_index[j - 1];
+                --j;
+            }
+            combo_index[j] = (combo_index_entry_t){.keycode = keycode, .combo = combo};
+        }
+    }
+    if (keys_count > INDEXED_COMBO_MAX_KEYS) {
+        uprintf("indexed combos: error: %u combo keys, INDEXED_COMBO_MAX_KEYS is %u; combos past the limit are disabled\n", keys_count, INDEXED_COMBO_MAX_KEYS);
+    }
+}
+
+/** \brief Find the range of index entries `[*first, *last)` for `keycode`. */
+static void combo_index_find(uint16_t keycode, uint16_t *first, uint16_t *last) {
+    uint16_t low = 0, high = combo_index_size;
+    while (low < high) {
+        uint16_t mid = (low + high) / 2;
+        if (combo_index[mid].keycode < keycode) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    *first = low;
+    while (low < combo_index_size && combo_index[low].keycode == keycode) {
+        ++low;
+    }
+    *last = low;
+}
+
+static void combo_register(uint16_t keycode) {
+    if (IS_QK_MOMENTARY(keycode)) {
+        layer_on(QK_MOMENTARY_GET_LAYER(keycode));
+    } else {
+        register_code16(keycode);
+    }
+}
+
+static void combo_unregister(uint16_t keycode) {
+    if (IS_QK_MOMENTARY(keycode)) {
+        layer_off(QK_MOMENTARY_GET_LAYER(keycode));
+    } else {
+        unregister_code16(keycode);
+    }
+}
+
+static void combo_fire(uint16_t combo) {
+#ifdef TRACE_ENABLE
+    // Recorded against the key completing the combo.
+    keypos_t key = combo_buffer[combo_buffer_length - 1].event.key;
+#endif // TRACE_ENABLE
+    if (combo_active_length < INDEXED_COMBO_MAX_ACTIVE) {
+        combo_active[combo_active_length].combo    = combo;
+        combo_active[combo_active_length].length   = combo_buffer_length;
+        combo_active[combo_active_length].released = 0;
+        for (uint8_t i = 0; i < combo_buffer_length; ++i) {
+            combo_active[combo_active_length].keys[i] = combo_buffer[i].event.key;
+        }
+        ++combo_active_length;
+        combo_register(key_combos[combo].keycode);
+#ifdef TRACE_ENABLE
+        trace_action(key, key_combos[combo].keycode, TRACE_PRESSED);
+#endif // TRACE_ENABLE
+    } else {
+        // No room left to track the release: tap the combo instead.
+        combo_register(key_combos[combo].keycode);
+        combo_unregister(key_combos[combo].keycode);
+#ifdef TRACE_ENABLE
+        trace_action(key, key_combos[combo].keycode, TRACE_TAP);
+#endif // TRACE_ENABLE
+    }
+    combo_buffer_length = 0;
+    combo_buffer_match  = -1;
+}
+
+/** \brief Resolve the buffer: fire its matching combo, or replay the presses. */
+static void combo_flush(void) {
+    if (combo_buffer_length == 0) {
+        return;
+    }
+    if (combo_buffer_match >= 0) {
+        combo_fire(combo_buffer_match);
+        return;
+    }
+    uint8_t length      = combo_buffer_length;
+    combo_buffer_length = 0;
+    combo_replaying     = true;
+    for (uint8_t i = 0; i < length; ++i) {
+        action_exec(combo_buffer[i].event);
+    }
+    combo_replaying = false;
+}
+
+/** \brief Whether every buffered key is part of `combo`. */
+static bool combo_contains_buffer(uint16_t combo) {
+    const uint16_t *keys = key_combos[combo].keys;
+    for (uint8_t i = 0; i < combo_buffer_length; ++i) {
+        uint16_t keycode;
+        uint8_t  j = 0;
+        while ((keycode = pgm_read_word(&keys[j])) != COMBO_END && keycode != combo_buffer[i].keycode) {
+            ++j;
+        }
+        if (keycode == COMBO_END) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * \brief Match the buffer against the combos containing its latest key.
+ *
+ * Any combo containing all the buffered keys contains the latest one, so the
+ * latest key's index entries are the only candidates.
+ *
+ * \return Whether a combo longer than the buffer could still complete.
+ */
+static bool combo_match(uint16_t first, uint16_t last) {
+    bool partial       = false;
+    combo_buffer_match = -1;
+    for (uint16_t i = first; i < last; ++i) {
+        uint16_t combo  = combo_index[i].combo;
+        uint8_t  length = combo_length(combo);
+        if (length < combo_buffer_length || !combo_contains_buffer(combo)) {
+            continue;
+        }
+        if (length == combo_buffer_length) {
+            if (combo_buffer_match < 0) {
+                combo_buffer_match = combo;
+            }
+        } else {
+            partial = true;
+        }
+    }
+    return partial;
+}
+
+/** \brief Handle the release of a key consumed by a combo. */
+static bool combo_release(keypos_t key) {
+    for (uint8_t i = 0; i < combo_active_length; ++i) {
+        for (uint8_t j = 0; j < combo_active[i].length; ++j) {
+            if (combo_active[i].keys[j].row != key.row || combo_active[i].keys[j].col != key.col) {
+                continue;
+            }
+            // The combo is released along with its first key.
+            if (combo_active[i].released++ == 0) {
+                combo_unregister(key_combos[combo_active[i].combo].keycode);
+#ifdef TRACE_ENABLE
+                trace_action(key, key_combos[combo_active[i].combo].keycode, 0);
+#endif // TRACE_ENABLE
+            }
+            combo_active[i].keys[j] = (keypos_t){.row = UINT8_MAX, .col = UINT8_MAX};
+            if (combo_active[i].released == combo_active[i].length) {
+                combo_active[i] = combo_active[--combo_active_length];
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+bool process_indexed_combos(uint16_t keycode, keyrecord_t *record) {
+    if (combo_replaying || !IS_KEYEVENT(record->event)) {
+        return true;
+    }
+
+    if (!record->event.pressed) {
+        // Resolve the buffer first, so that events stay in order.  A buffered
+        // key released before the combo resolved may still fire the combo
+        // matching the buffer, which then owns the release.
+        combo_flush();
+        return !combo_release(record->event.key);
+    }
+
+    uint16_t first, last;
+    combo_index_find(keycode, &first, &last);
+    if (first == last) {
+        // Not part of any combo.
+        combo_flush();
+        return true;
+    }
+
+    if (combo_buffer_length == INDEXED_COMBO_MAX_LENGTH) {
+        combo_flush();
+    }
+    if (combo_buffer_length == 0) {
+        combo_buffer_timer = timer_read();
+    }
+    combo_buffer[combo_buffer_length].event   = record->event;
+    combo_buffer[combo_buffer_length].keycode = keycode;
+    ++combo_buffer_length;
+
+    int16_t previous_match = combo_buffer_match;
+    bool    partial        = combo_match(first, last);
+    if (!partial && combo_buffer_match < 0 && combo_buffer_length > 1) {
+        // The key does not extend the buffered keys into a combo: resolve
+        // them, then start over with this key alone.
+        --combo_buffer_length;
+        combo_buffer_match = previous_match;
+        combo_flush();
+        combo_buffer[0].event   = record->event;
+        combo_buffer[0].keycode = keycode;
+        combo_buffer_length     = 1;
+        combo_buffer_timer      = timer_read();
+        partial                 = combo_match(first, last);
+    }
+    if (!partial && combo_buffer_match >= 0) {
+        combo_fire(combo_buffer_match);
+    }
+    return false;
+}
+
+bool indexed_combos_replaying(void) {
+    return combo_replaying;
+}
+
+void indexed_combos_task(void) {
+    if (combo_buffer_length > 0 && timer_elapsed(combo_buffer_timer) > COMBO_TERM) {
+        combo_flush();
+    }
+}
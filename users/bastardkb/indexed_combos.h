@@ -0,0 +1,74 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <stdint.h>
+#include "action.h"
+
+/*
+ * Indexed combo engine.
+ *
+ * Drop-in replacement for QMK's combo engine (`COMBO_ENABLE`) that keeps the
+ * keymap's `key_combos[]` definitions.  QMK walks every combo, and every key of
+ * every combo, on each key press.  Here the combo keys are sorted into an index
+ * once at startup so that a press only looks at the combos that contain its
+ * keycode, ie. `O(log(keys) + candidates)` instead of `O(keys)`.
+ *
+ * The keymap must also export the number of combos:
+ *
+ *     const uint16_t key_combos_count = ARRAY_SIZE(key_combos);
+ */
+
+#ifndef COMBO_TERM
+#    define COMBO_TERM 50
+#endif // COMBO_TERM
+
+#ifndef INDEXED_COMBO_MAX_KEYS
+/** \brief Size of the key index, ie. the total number of keys in all combos. */
+#    define INDEXED_COMBO_MAX_KEYS 64
+#endif // INDEXED_COMBO_MAX_KEYS
+
+#ifndef INDEXED_COMBO_MAX_LENGTH
+/** \brief Maximum number of keys in a single combo. */
+#    define INDEXED_COMBO_MAX_LENGTH 4
+#endif // INDEXED_COMBO_MAX_LENGTH
+
+#ifndef INDEXED_COMBO_MAX_ACTIVE
+/** \brief Maximum number of combos held down at the same time. */
+#    define INDEXED_COMBO_MAX_ACTIVE 4
+#endif // INDEXED_COMBO_MAX_ACTIVE
+
+#ifndef COMBO_END
+#    define COMBO_END 0
+#endif // COMBO_END
+
+/** \brief Same layout as QMK's `combo_t`, so combo definitions are unchanged. */
+typedef struct {
+    const uint16_t *keys;
+    uint16_t        keycode;
+} combo_t;
+
+#define COMBO(ck, ca) {.keys = &(ck)[0], .keycode = (ca)}
+
+extern combo_t        key_combos[];
+extern const uint16_t key_combos_count;
+
+void indexed_combos_init(void);
+bool process_indexed_combos(uint16_t keycode, keyrecord_t *record);
+void indexed_combos_task(void);
+/** \brief Whether buffered presses are being replayed, ie. sent again through `action_exec`. */
+bool indexed_combos_replaying(void);
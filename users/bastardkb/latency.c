@@ -0,0 +1,144 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "latency.h"
+#include "host.h"
+#include "print.h"
+#include "timing.h"
+
+static latency_stats_t latency_stats            = {0};
+static uint32_t        latency_last_print_count = 0;
+
+/**
+ * \brief Host driver wrapper.
+ *
+ * The active host driver is copied and its keyboard callbacks replaced with
+ * ones that timestamp the outgoing report before forwarding it.
+ */
+static host_driver_t latency_host_driver;
+static void (*latency_send_keyboard_next)(report_keyboard_t *report) = NULL;
+#ifdef NKRO_ENABLE
+static void (*latency_send_nkro_next)(report_nkro_t *report) = NULL;
+#endif // NKRO_ENABLE
+
+/** \brief State of the event currently being measured. */
+static struct {
+    timing_t start;
+    uint16_t event_time;
+    bool     in_process;
+    bool     awaiting_report;
+} latency_event = {0};
+
+static void latency_stat_add(latency_stat_t *stat, uint32_t value) {
+    if (stat->count == 0 || value < stat->min) {
+        stat->min = value;
+    }
+    if (value > stat->max) {
+        stat->max = value;
+    }
+    stat->total += value;
+    ++stat->count;
+}
+
+static void latency_on_report(void) {
+    if (!latency_event.awaiting_report) {
+        return;
+    }
+    latency_event.awaiting_report = false;
+    if (latency_event.in_process) {
+        latency_stat_add(&latency_stats.report_us, timing_elapsed_us(latency_event.start));
+    }
+    latency_stat_add(&latency_stats.input_ms, TIMER_DIFF_16(timer_read(), latency_event.event_time));
+}
+
+static void latency_send_keyboard(report_keyboard_t *report) {
+    latency_send_keyboard_next(report);
+    latency_on_report();
+}
+
+#ifdef NKRO_ENABLE
+static void latency_send_nkro(report_nkro_t *report) {
+    latency_send_nkro_next(report);
+    latency_on_report();
+}
+#endif // NKRO_ENABLE
+
+void latency_record_begin(keyrecord_t *record) {
+    // A previous event that never produced a report (eg. a layer key) is
+    // simply dropped.
+    latency_event.start           = timing_read();
+    latency_event.event_time      = record->event.time;
+    latency_event.in_process      = true;
+    latency_event.awaiting_report = true;
+}
+
+void latency_record_end(void) {
+    if (!latency_event.in_process) {
+        return;
+    }
+    latency_event.in_process = false;
+    latency_stat_add(&latency_stats.process_us, timing_elapsed_us(latency_event.start));
+}
+
+void latency_task(void) {
+    // Events are processed before the housekeeping task of their scan.  One
+    // still in process here was stopped after the userspace, before
+    // `post_process_record_user` (eg. by the keyboard's `process_record_kb`):
+    // drop its figures, so that later reports are not charged to it.
+    latency_event.in_process = false;
+
+    host_driver_t *driver = host_get_driver();
+    // The host driver is only set once the USB stack is up, after
+    // `keyboard_post_init_user`, so install the wrapper lazily.
+    if (driver != NULL && driver != &latency_host_driver) {
+        latency_host_driver               = *driver;
+        latency_send_keyboard_next        = driver->send_keyboard;
+        latency_host_driver.send_keyboard = latency_send_keyboard;
+#ifdef NKRO_ENABLE
+        latency_send_nkro_next        = driver->send_nkro;
+        latency_host_driver.send_nkro = latency_send_nkro;
+#endif // NKRO_ENABLE
+        host_set_driver(&latency_host_driver);
+    }
+
+    if (latency_stats.process_us.count - latency_last_print_count >= LATENCY_STATS_REPORT_EVENTS) {
+        latency_last_print_count = latency_stats.process_us.count;
+        latency_stats_print();
+    }
+}
+
+const latency_stats_t *latency_stats_get(void) {
+    return &latency_stats;
+}
+
+void latency_stats_reset(void) {
+    latency_stats            = (latency_stats_t){0};
+    latency_last_print_count = 0;
+}
+
+static void latency_stat_print(const char *name, const latency_stat_t *stat, const char *unit) {
+    if (stat->count == 0) {
+        uprintf("latency: %s n/a\n", name);
+        return;
+    }
+    uprintf("latency: %s min %lu avg %lu max %lu %s (n=%lu)\n", name, stat->min, stat->total / stat->count, stat->max, unit, stat->count);
+}
+
+void latency_stats_print(void) {
+    latency_stat_print("process", &latency_stats.process_us, "us");
+    latency_stat_print("report", &latency_stats.report_us, "us");
+    latency_stat_print("input", &latency_stats.input_ms, "ms");
+}
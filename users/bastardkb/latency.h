@@ -0,0 +1,59 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <stdint.h>
+#include "action.h"
+
+#ifndef LATENCY_STATS_REPORT_EVENTS
+/** \brief Number of processed key events between two console reports. */
+#    define LATENCY_STATS_REPORT_EVENTS 100
+#endif // LATENCY_STATS_REPORT_EVENTS
+
+typedef struct {
+    uint32_t count;
+    uint32_t total;
+    uint32_t min;
+    uint32_t max;
+} latency_stat_t;
+
+/**
+ * \brief Key event latency figures.
+ *
+ * - `process_us`: time spent in `process_record` for a single event, from the
+ *   userspace `process_record_user` to `post_process_record_user` (or to the
+ *   keymap returning `false`).  Includes macros sent from the keymap.  Events
+ *   stopped by the keyboard's `process_record_kb` are not counted.
+ * - `report_us`: time from the start of processing to the first keyboard
+ *   report handed to the host driver.
+ * - `input_ms`: time from the matrix scan that produced the event to the
+ *   first keyboard report it caused.  Includes the time spent waiting on
+ *   tap-hold, tap dance and combo decisions.
+ */
+typedef struct {
+    latency_stat_t process_us;
+    latency_stat_t report_us;
+    latency_stat_t input_ms;
+} latency_stats_t;
+
+void latency_record_begin(keyrecord_t *record);
+void latency_record_end(void);
+void latency_task(void);
+
+const latency_stats_t *latency_stats_get(void);
+void                   latency_stats_reset(void);
+void                   latency_stats_print(void);
@@ -0,0 +1,84 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdlib.h>
+#include "pointer_accel.h"
+#include "progmem.h"
+#include "timer.h"
+
+_Static_assert(POINTER_ACCEL_OFFSET > 0, "POINTER_ACCEL_OFFSET must be positive");
+
+#define POINTER_ACCEL_GAIN_8(v) POINTER_ACCEL_GAIN(v), POINTER_ACCEL_GAIN(v + 1), POINTER_ACCEL_GAIN(v + 2), POINTER_ACCEL_GAIN(v + 3), POINTER_ACCEL_GAIN(v + 4), POINTER_ACCEL_GAIN(v + 5), POINTER_ACCEL_GAIN(v + 6), POINTER_ACCEL_GAIN(v + 7)
+
+/** \brief Gain for each speed, computed at compile time. */
+static const uint16_t PROGMEM pointer_accel_table[POINTER_ACCEL_TABLE_SIZE] = {
+    POINTER_ACCEL_GAIN_8(0),  POINTER_ACCEL_GAIN_8(8),  POINTER_ACCEL_GAIN_8(16), POINTER_ACCEL_GAIN_8(24),
+    POINTER_ACCEL_GAIN_8(32), POINTER_ACCEL_GAIN_8(40), POINTER_ACCEL_GAIN_8(48), POINTER_ACCEL_GAIN_8(56),
+};
+
+#ifdef MOUSE_EXTENDED_REPORT
+#    define POINTER_ACCEL_XY_MAX INT16_MAX
+#else
+#    define POINTER_ACCEL_XY_MAX INT8_MAX
+#endif // MOUSE_EXTENDED_REPORT
+
+/** \brief Sub-count remainders, in 1/256th of a count. */
+static int16_t  pointer_accel_remainder_x  = 0;
+static int16_t  pointer_accel_remainder_y  = 0;
+static uint16_t pointer_accel_motion_timer = 0;
+
+static int16_t pointer_accel_scale(int16_t value, uint16_t gain, int16_t *remainder) {
+    if ((value < 0 && *remainder > 0) || (value > 0 && *remainder < 0)) {
+        // The remainder is motion in the other direction.
+        *remainder = 0;
+    }
+    int32_t scaled = (int32_t)value * gain + *remainder;
+    int32_t result = scaled / 256;
+    *remainder     = scaled - result * 256;
+    if (result > POINTER_ACCEL_XY_MAX) {
+        return POINTER_ACCEL_XY_MAX;
+    }
+    if (result < -POINTER_ACCEL_XY_MAX) {
+        return -POINTER_ACCEL_XY_MAX;
+    }
+    return result;
+}
+
+report_mouse_t pointer_accel_apply(report_mouse_t mouse_report) {
+    if (mouse_report.x == 0 && mouse_report.y == 0) {
+        if (timer_elapsed(pointer_accel_motion_timer) > POINTER_ACCEL_REMAINDER_TIMEOUT_MS) {
+            pointer_accel_reset();
+        }
+        return mouse_report;
+    }
+    pointer_accel_motion_timer = timer_read();
+    // Octagonal approximation of the euclidean norm: max + min / 2.
+    uint16_t ax    = abs(mouse_report.x);
+    uint16_t ay    = abs(mouse_report.y);
+    uint16_t speed = ax > ay ? ax + ay / 2 : ay + ax / 2;
+    if (speed >= POINTER_ACCEL_TABLE_SIZE) {
+        speed = POINTER_ACCEL_TABLE_SIZE - 1;
+    }
+    uint16_t gain  = pgm_read_word(&pointer_accel_table[speed]);
+    mouse_report.x = pointer_accel_scale(mouse_report.x, gain, &pointer_accel_remainder_x);
+    mouse_report.y = pointer_accel_scale(mouse_report.y, gain, &pointer_accel_remainder_y);
+    return mouse_report;
+}
+
+void pointer_accel_reset(void) {
+    pointer_accel_remainder_x = 0;
+    pointer_accel_remainder_y = 0;
+}
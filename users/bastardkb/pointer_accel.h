@@ -0,0 +1,69 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <stdint.h>
+#include "report.h"
+
+/*
+ * Pointer acceleration.
+ *
+ * Scales each motion report by a gain that depends on the pointer speed, using
+ * integer math only.  The gain curve is evaluated by the compiler into a lookup
+ * table, so the per-report cost is one table read regardless of the curve.
+ * Fractional counts left over by the scaling are carried over to the next
+ * report, so slow motion is never lost.  They are dropped when the motion
+ * changes direction or stops.
+ *
+ * Gains are 8.8 fixed point: 256 is a gain of 1.
+ */
+
+#ifndef POINTER_ACCEL_MIN_GAIN
+/** \brief Gain at rest, used for precise movements. */
+#    define POINTER_ACCEL_MIN_GAIN 192
+#endif // POINTER_ACCEL_MIN_GAIN
+
+#ifndef POINTER_ACCEL_MAX_GAIN
+/** \brief Gain reached at high speed, used for long movements. */
+#    define POINTER_ACCEL_MAX_GAIN 768
+#endif // POINTER_ACCEL_MAX_GAIN
+
+#ifndef POINTER_ACCEL_OFFSET
+/** \brief Speed, in counts per report, at which the gain is halfway between min and max. */
+#    define POINTER_ACCEL_OFFSET 12
+#endif // POINTER_ACCEL_OFFSET
+
+#ifndef POINTER_ACCEL_GAIN
+/**
+ * \brief Gain curve, for a speed `v` in counts per report.
+ *
+ * Must be an integer constant expression.  Defaults to a smooth step from
+ * `POINTER_ACCEL_MIN_GAIN` to `POINTER_ACCEL_MAX_GAIN`.
+ */
+#    define POINTER_ACCEL_GAIN(v) (POINTER_ACCEL_MIN_GAIN + ((int32_t)(POINTER_ACCEL_MAX_GAIN - POINTER_ACCEL_MIN_GAIN) * (v) * (v)) / ((v) * (v) + POINTER_ACCEL_OFFSET * POINTER_ACCEL_OFFSET))
+#endif // POINTER_ACCEL_GAIN
+
+#ifndef POINTER_ACCEL_REMAINDER_TIMEOUT_MS
+/** \brief Time without motion after which the fractional counts left over are dropped. */
+#    define POINTER_ACCEL_REMAINDER_TIMEOUT_MS 100
+#endif // POINTER_ACCEL_REMAINDER_TIMEOUT_MS
+
+/** \brief Number of entries in the gain table, faster speeds use the last entry. */
+#define POINTER_ACCEL_TABLE_SIZE 64
+
+report_mouse_t pointer_accel_apply(report_mouse_t mouse_report);
+void           pointer_accel_reset(void);
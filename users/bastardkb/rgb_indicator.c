@@ -0,0 +1,177 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <string.h>
+#include "rgb_indicator.h"
+#include "quantum.h"
+#include "scheduler.h"
+
+#define RGB_INDICATOR_NO_KEY 0xFF
+
+// LEDs store their key as `row << 4 | col`, 0xFF being no key.
+_Static_assert(MATRIX_ROWS <= 15 && MATRIX_COLS <= 16, "Matrix too large for the LED key positions");
+
+/** \brief Key position of each LED, as `row << 4 | col`. */
+static uint8_t rgb_indicator_led_key[RGB_MATRIX_LED_COUNT];
+/** \brief Color last written to each LED. */
+static RGB rgb_indicator_painted[RGB_MATRIX_LED_COUNT];
+
+static uint8_t rgb_indicator_led_first = 0;
+static uint8_t rgb_indicator_led_last  = RGB_MATRIX_LED_COUNT;
+
+static layer_state_t rgb_indicator_layer_state = 0;
+static uint8_t       rgb_indicator_layer       = 0;
+static RGB           rgb_indicator_color       = {0};
+static bool          rgb_indicator_active      = false;
+static uint8_t       rgb_indicator_saved_mode  = RGB_MATRIX_DEFAULT_MODE;
+
+/** \brief Next LED to compare, repainting is done once it reaches the last LED. */
+static uint8_t rgb_indicator_cursor = RGB_MATRIX_LED_COUNT;
+/** \brief Set when the LEDs may differ from `rgb_indicator_painted`: the current repaint writes them all. */
+static bool rgb_indicator_stale = false;
+/** \brief Whether the RGB matrix was enabled on the last task. */
+static bool rgb_indicator_matrix_enabled = true;
+/** \brief Set by `rgb_indicator_refresh`. */
+static volatile bool rgb_indicator_refresh_pending = false;
+
+/** \brief Armed until the RGB matrix has settled, eg. until the effect switch has cleared the LEDs. */
+static scheduler_timer_t rgb_indicator_start_timer = SCHEDULER_TIMER(NULL);
+
+__attribute__((weak)) bool rgb_indicator_layer_color_keymap(uint8_t layer, HSV *hsv) {
+    return false;
+}
+
+void rgb_indicator_init(void) {
+    memset(rgb_indicator_led_key, RGB_INDICATOR_NO_KEY, sizeof(rgb_indicator_led_key));
+    for (uint8_t row = 0; row < MATRIX_ROWS; ++row) {
+        for (uint8_t col = 0; col < MATRIX_COLS; ++col) {
+            uint8_t led = g_led_config.matrix_co[row][col];
+            if (led < RGB_MATRIX_LED_COUNT) {
+                rgb_indicator_led_key[led] = row << 4 | col;
+            }
+        }
+    }
+#ifdef RGB_MATRIX_SPLIT
+    // Only paint this half's LEDs, the others are ignored by `rgb_matrix_set_color`.
+    const uint8_t split[2]  = RGB_MATRIX_SPLIT;
+    rgb_indicator_led_first = is_keyboard_left() ? 0 : split[0];
+    rgb_indicator_led_last  = is_keyboard_left() ? split[0] : RGB_MATRIX_LED_COUNT;
+#endif // RGB_MATRIX_SPLIT
+    rgb_indicator_cursor         = rgb_indicator_led_last;
+    rgb_indicator_matrix_enabled = rgb_matrix_is_enabled();
+}
+
+static RGB rgb_indicator_led_target(uint8_t led) {
+    uint8_t key = rgb_indicator_led_key[led];
+    if (key != RGB_INDICATOR_NO_KEY) {
+        uint16_t keycode = keymap_key_to_keycode(rgb_indicator_layer, (keypos_t){.row = key >> 4, .col = key & 0xF});
+        if (keycode == KC_NO || keycode == KC_TRNS) {
+            return (RGB){0};
+        }
+    }
+    return rgb_indicator_color;
+}
+
+static void rgb_indicator_layer_changed(void) {
+    HSV hsv;
+    rgb_indicator_layer = get_highest_layer(rgb_indicator_layer_state | default_layer_state);
+    if (!rgb_indicator_layer_color_keymap(rgb_indicator_layer, &hsv)) {
+        if (rgb_indicator_active) {
+            rgb_indicator_active = false;
+            rgb_indicator_cursor = rgb_indicator_led_last;
+            // On split keyboards, the effect is synced from the primary half.
+            if (is_keyboard_master()) {
+                rgb_matrix_mode_noeeprom(rgb_indicator_saved_mode);
+            }
+        }
+        return;
+    }
+    if (!rgb_indicator_active) {
+        rgb_indicator_active = true;
+        if (is_keyboard_master()) {
+            rgb_indicator_saved_mode = rgb_matrix_get_mode();
+            rgb_matrix_mode_noeeprom(RGB_MATRIX_NONE);
+        }
+        // The effect switch turns all the LEDs off.
+        memset(rgb_indicator_painted, 0, sizeof(rgb_indicator_painted));
+        scheduler_arm(&rgb_indicator_start_timer, RGB_INDICATOR_START_DELAY_MS);
+    }
+    if (hsv.v > rgb_matrix_get_val()) {
+        hsv.v = rgb_matrix_get_val();
+    }
+    rgb_indicator_color  = hsv_to_rgb(hsv);
+    rgb_indicator_cursor = rgb_indicator_led_first;
+}
+
+/** \brief Write every LED on the next repaint, once the RGB matrix had time to settle. */
+static void rgb_indicator_invalidate(void) {
+    rgb_indicator_stale = true;
+    if (rgb_indicator_active) {
+        rgb_indicator_cursor = rgb_indicator_led_first;
+        scheduler_arm(&rgb_indicator_start_timer, RGB_INDICATOR_START_DELAY_MS);
+    }
+}
+
+void rgb_indicator_suspend(void) {
+    // The RGB matrix turns the LEDs off while suspended.
+    rgb_indicator_invalidate();
+}
+
+void rgb_indicator_wakeup(void) {
+    rgb_indicator_invalidate();
+}
+
+void rgb_indicator_refresh(void) {
+    rgb_indicator_refresh_pending = true;
+}
+
+void rgb_indicator_task(void) {
+    if (layer_state != rgb_indicator_layer_state || rgb_indicator_refresh_pending) {
+        rgb_indicator_layer_state     = layer_state;
+        rgb_indicator_refresh_pending = false;
+        rgb_indicator_layer_changed();
+    }
+    bool enabled = rgb_matrix_is_enabled();
+    if (enabled != rgb_indicator_matrix_enabled) {
+        // Turning the RGB matrix off or on clears the LEDs.
+        rgb_indicator_matrix_enabled = enabled;
+        rgb_indicator_invalidate();
+    }
+    if (!enabled || rgb_indicator_cursor >= rgb_indicator_led_last) {
+        return;
+    }
+    if (scheduler_is_armed(&rgb_indicator_start_timer)) {
+        return;
+    }
+
+    uint8_t last = rgb_indicator_cursor + RGB_INDICATOR_LEDS_PER_TASK;
+    if (last > rgb_indicator_led_last) {
+        last = rgb_indicator_led_last;
+    }
+    for (; rgb_indicator_cursor < last; ++rgb_indicator_cursor) {
+        uint8_t led    = rgb_indicator_cursor;
+        RGB     target = rgb_indicator_led_target(led);
+        if (!rgb_indicator_stale && memcmp(&target, &rgb_indicator_painted[led], sizeof(RGB)) == 0) {
+            continue;
+        }
+        rgb_matrix_set_color(led, target.r, target.g, target.b);
+        rgb_indicator_painted[led] = target;
+    }
+    // The LED driver is flushed by `rgb_matrix_task`, on its next render cycle.
+    if (rgb_indicator_cursor >= rgb_indicator_led_last) {
+        rgb_indicator_stale = false;
+    }
+}
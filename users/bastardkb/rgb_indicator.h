@@ -0,0 +1,76 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <stdint.h>
+#include "color.h"
+
+/*
+ * Layer indicator renderer.
+ *
+ * When the highest active layer has an indicator color, the RGB matrix effect
+ * is switched off and the keys mapped on that layer are lit with the layer's
+ * color (unmapped keys are turned off, LEDs without a key take the color too).
+ * The previous effect is restored when leaving the layer.
+ *
+ * Only LEDs whose color changed since the last repaint are written, nothing
+ * when the layer state did not change.  The LED driver is not flushed here:
+ * `rgb_matrix_task` flushes it on every render cycle, `RGB_MATRIX_NONE`
+ * included.  A repaint is spread over several loop iterations,
+ * `RGB_INDICATOR_LEDS_PER_TASK` LEDs at a time, so it never takes more than a
+ * fixed amount of time away from the matrix scan.  Nothing is painted while
+ * the RGB matrix is disabled; all the LEDs are repainted after it is enabled
+ * again, and after a suspend.
+ *
+ * On split keyboards each half paints its own LEDs from the layer state, which
+ * must be synced with `SPLIT_LAYER_STATE_ENABLE`.
+ */
+
+#ifndef RGB_INDICATOR_LEDS_PER_TASK
+/** \brief Number of LEDs compared, and possibly written, per loop iteration. */
+#    define RGB_INDICATOR_LEDS_PER_TASK 8
+#endif // RGB_INDICATOR_LEDS_PER_TASK
+
+#ifndef RGB_INDICATOR_START_DELAY_MS
+/**
+ * \brief Time to wait after switching the effect off before painting.
+ *
+ * Switching to `RGB_MATRIX_NONE` clears all the LEDs on the next render cycle,
+ * which must happen before the first repaint.
+ */
+#    define RGB_INDICATOR_START_DELAY_MS (2 * RGB_MATRIX_LED_FLUSH_LIMIT)
+#endif // RGB_INDICATOR_START_DELAY_MS
+
+/**
+ * \brief Return the indicator color of a layer.
+ *
+ * Implemented by the keymap.  Return `false` for layers without an indicator.
+ */
+bool rgb_indicator_layer_color_keymap(uint8_t layer, HSV *hsv);
+
+/**
+ * \brief Query the indicator color again and repaint, on the next task.
+ *
+ * For colors depending on more than the layer, eg. a pointer mode.  Safe to
+ * call from `split_sync_received_keymap`.
+ */
+void rgb_indicator_refresh(void);
+
+void rgb_indicator_init(void);
+void rgb_indicator_task(void);
+void rgb_indicator_suspend(void);
+void rgb_indicator_wakeup(void);
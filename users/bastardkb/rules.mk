@@ -0,0 +1,103 @@
+SRC += bastardkb.c scheduler.c
+
+ifeq ($(strip $(POINTING_DEVICE_ENABLE)), yes)
+    # Enabled by the keyboards' `*_AUTO_POINTER_LAYER_TRIGGER_ENABLE` defines.
+    SRC += auto_pointer.c
+endif
+
+LATENCY_STATS_ENABLE ?= no
+ifeq ($(strip $(LATENCY_STATS_ENABLE)), yes)
+    SRC += latency.c
+    OPT_DEFS += -DLATENCY_STATS_ENABLE
+endif
+
+INDEXED_COMBO_ENABLE ?= no
+ifeq ($(strip $(INDEXED_COMBO_ENABLE)), yes)
+    # Replaces QMK's combo engine, keeping the keymap's `key_combos[]`.
+    COMBO_ENABLE = no
+    SRC += indexed_combos.c
+    OPT_DEFS += -DINDEXED_COMBO_ENABLE
+endif
+
+HOOK_PROFILER_ENABLE ?= no
+ifeq ($(strip $(HOOK_PROFILER_ENABLE)), yes)
+    SRC += hook_profiler.c
+    OPT_DEFS += -DHOOK_PROFILER_ENABLE
+endif
+
+POINTER_ACCEL_ENABLE ?= no
+ifeq ($(strip $(POINTER_ACCEL_ENABLE)), yes)
+    ifeq ($(strip $(POINTING_DEVICE_ENABLE)), yes)
+        SRC += pointer_accel.c
+        OPT_DEFS += -DPOINTER_ACCEL_ENABLE
+    endif
+endif
+
+BURST_MACRO_ENABLE ?= no
+ifeq ($(strip $(BURST_MACRO_ENABLE)), yes)
+    SRC += burst_macro.c
+    OPT_DEFS += -DBURST_MACRO_ENABLE
+endif
+
+RGB_INDICATOR_ENABLE ?= no
+ifeq ($(strip $(RGB_INDICATOR_ENABLE)), yes)
+    ifeq ($(strip $(RGB_MATRIX_ENABLE)), yes)
+        SRC += rgb_indicator.c
+        OPT_DEFS += -DRGB_INDICATOR_ENABLE
+    endif
+endif
+
+SPLIT_SYNC_ENABLE ?= no
+ifeq ($(strip $(SPLIT_SYNC_ENABLE)), yes)
+    ifeq ($(strip $(SPLIT_KEYBOARD)), yes)
+        SRC += split_sync.c
+        OPT_DEFS += -DSPLIT_SYNC_ENABLE
+    endif
+endif
+
+SPARSE_KEYMAP_ENABLE ?= no
+ifeq ($(strip $(SPARSE_KEYMAP_ENABLE)), yes)
+    SRC += sparse_keymap.c
+    OPT_DEFS += -DSPARSE_KEYMAP_ENABLE
+
+    # Generated from the keymap's `keymaps` array, included by `keymap.c`, next
+    # to QMK's generated headers.  Older QMK versions have no
+    # `INTERMEDIATE_OUTPUT`.
+    SPARSE_KEYMAP_DATA := $(or $(INTERMEDIATE_OUTPUT),$(KEYMAP_OUTPUT))/src/sparse_keymap_data.h
+$(SPARSE_KEYMAP_DATA): $(KEYMAP_C) $(USER_PATH)/sparse_keymap.py
+	@mkdir -p $(@D)
+	python3 $(USER_PATH)/sparse_keymap.py --keyboard $(KEYBOARD) --output $@ $(KEYMAP_C)
+
+generated-files: $(SPARSE_KEYMAP_DATA)
+endif
+
+ENCODER_BATCH_ENABLE ?= no
+ifeq ($(strip $(ENCODER_BATCH_ENABLE)), yes)
+    # Only encoders mapped with `encoder_map` produce key events.
+    ifeq ($(strip $(ENCODER_MAP_ENABLE)), yes)
+        SRC += encoder_batch.c
+        OPT_DEFS += -DENCODER_BATCH_ENABLE
+    endif
+endif
+
+TRACE_ENABLE ?= no
+ifeq ($(strip $(TRACE_ENABLE)), yes)
+    # The trace is read over raw HID.
+    RAW_ENABLE = yes
+    SRC += trace.c
+    OPT_DEFS += -DTRACE_ENABLE
+endif
+
+ADAPTIVE_TAP_HOLD_ENABLE ?= no
+ifeq ($(strip $(ADAPTIVE_TAP_HOLD_ENABLE)), yes)
+    SRC += adaptive_tap_hold.c
+    OPT_DEFS += -DADAPTIVE_TAP_HOLD_ENABLE
+endif
+
+DRAG_SCROLL_ENABLE ?= no
+ifeq ($(strip $(DRAG_SCROLL_ENABLE)), yes)
+    ifeq ($(strip $(POINTING_DEVICE_ENABLE)), yes)
+        SRC += drag_scroll.c
+        OPT_DEFS += -DDRAG_SCROLL_ENABLE
+    endif
+endif
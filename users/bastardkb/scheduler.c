@@ -0,0 +1,85 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stddef.h>
+#include "scheduler.h"
+#include "timer.h"
+
+static scheduler_timer_t *scheduler_armed = NULL;
+/** \brief Time the remaining times of the armed timers are counted from. */
+static uint16_t scheduler_time = 0;
+
+void scheduler_arm(scheduler_timer_t *timer, uint16_t timeout) {
+    if (scheduler_armed == NULL) {
+        scheduler_time = timer_read();
+    }
+    // A remaining time of 0 marks the timers expiring in `scheduler_task`.
+    timer->remaining = timeout > 0 ? timeout : 1;
+    if (!timer->armed) {
+        timer->armed    = true;
+        timer->next     = scheduler_armed;
+        scheduler_armed = timer;
+    }
+}
+
+void scheduler_cancel(scheduler_timer_t *timer) {
+    if (!timer->armed) {
+        return;
+    }
+    for (scheduler_timer_t **link = &scheduler_armed; *link != NULL; link = &(*link)->next) {
+        if (*link == timer) {
+            *link = timer->next;
+            break;
+        }
+    }
+    timer->armed = false;
+}
+
+/** \brief Disarm and return the first expired timer, `NULL` if there is none. */
+static scheduler_timer_t *scheduler_pop_expired(void) {
+    for (scheduler_timer_t **link = &scheduler_armed; *link != NULL; link = &(*link)->next) {
+        scheduler_timer_t *timer = *link;
+        if (timer->remaining == 0) {
+            *link        = timer->next;
+            timer->armed = false;
+            return timer;
+        }
+    }
+    return NULL;
+}
+
+void scheduler_task(void) {
+    if (scheduler_armed == NULL) {
+        return;
+    }
+    uint16_t now     = timer_read();
+    uint16_t elapsed = TIMER_DIFF_16(now, scheduler_time);
+    if (elapsed == 0) {
+        return;
+    }
+    scheduler_time = now;
+
+    for (scheduler_timer_t *timer = scheduler_armed; timer != NULL; timer = timer->next) {
+        timer->remaining = timer->remaining > elapsed ? timer->remaining - elapsed : 0;
+    }
+    // One at a time, as callbacks may arm or cancel timers.
+    scheduler_timer_t *timer;
+    while ((timer = scheduler_pop_expired()) != NULL) {
+        if (timer->callback != NULL) {
+            timer->callback();
+        }
+    }
+}
@@ -0,0 +1,63 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * One-shot timers.
+ *
+ * A timer is a statically allocated `scheduler_timer_t`, bound to the callback
+ * run when it expires.  Arming a timer sets its deadline, arming it again
+ * before it expires pushes the deadline forward.
+ *
+ * Armed timers are kept in a list, each counting down the time left to its
+ * deadline.  `scheduler_task` returns right away while the list is empty, so
+ * idle timers cost nothing in the loop.  The system timer is only read when
+ * the first timer gets armed and, while timers are armed, once per loop
+ * iteration to count down: rearming an armed timer just stores its timeout,
+ * which makes it cheap enough to do on every event that extends a timeout,
+ * such as every pointing device report.  The timeout is then counted from
+ * the last loop iteration, so a timer may expire up to one iteration early.
+ */
+
+typedef struct scheduler_timer_t {
+    /** \brief Run once when the timer expires, may be `NULL` for timers that are only polled. */
+    void (*callback)(void);
+    uint16_t                  remaining;
+    bool                      armed;
+    struct scheduler_timer_t *next;
+} scheduler_timer_t;
+
+/** \brief Initializer of a timer running `function` when it expires. */
+#define SCHEDULER_TIMER(function) \
+    { .callback = (function) }
+
+/** \brief Arm a timer to expire in `timeout` ms, or push its deadline if it is armed. */
+void scheduler_arm(scheduler_timer_t *timer, uint16_t timeout);
+
+/** \brief Disarm a timer without running its callback. */
+void scheduler_cancel(scheduler_timer_t *timer);
+
+/** \brief Return whether a timer is armed. */
+static inline bool scheduler_is_armed(const scheduler_timer_t *timer) {
+    return timer->armed;
+}
+
+/** \brief Count down the armed timers and run the callbacks of the expired ones. */
+void scheduler_task(void);
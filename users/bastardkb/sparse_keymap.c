@@ -0,0 +1,73 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "sparse_keymap.h"
+
+uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
+    if (layer_num >= sparse_keymap_layer_count || row >= MATRIX_ROWS || column >= MATRIX_COLS) {
+        return KC_TRNS;
+    }
+    sparse_keymap_mask_t mask = pgm_read_sparse_keymap_mask(&sparse_keymap_masks[layer_num][row]);
+    sparse_keymap_mask_t bit  = (sparse_keymap_mask_t)1 << column;
+    if (!(mask & bit)) {
+        return pgm_read_word(&sparse_keymap_fill[layer_num]);
+    }
+    uint16_t index = pgm_read_word(&sparse_keymap_layer_offsets[layer_num]) + pgm_read_byte(&sparse_keymap_row_offsets[layer_num][row]) + __builtin_popcountl(mask & (bit - 1));
+    return pgm_read_word(&sparse_keymap_keycodes[index]);
+}
+
+#ifdef SPARSE_KEYMAP_BENCHMARK
+#    include "print.h"
+#    include "timing.h"
+
+void sparse_keymap_benchmark_task(void) {
+    static bool done = false;
+    if (done || timer_read32() < SPARSE_KEYMAP_BENCHMARK_DELAY_MS) {
+        return;
+    }
+    done = true;
+
+    uint16_t mismatches = 0;
+    for (uint8_t layer = 0; layer < sparse_keymap_layer_count; ++layer) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; ++row) {
+            for (uint8_t col = 0; col < MATRIX_COLS; ++col) {
+                mismatches += keycode_at_keymap_location(layer, row, col) != keycode_at_keymap_location_raw(layer, row, col);
+            }
+        }
+    }
+
+    // Accumulate the keycodes, so that the lookups are not optimized away.
+    volatile uint16_t sink = 0;
+    timing_t          start;
+    uint32_t          elapsed[2];
+    for (uint8_t sparse = 0; sparse < 2; ++sparse) {
+        uint16_t sum = 0;
+        start        = timing_read();
+        for (uint16_t round = 0; round < SPARSE_KEYMAP_BENCHMARK_ROUNDS; ++round) {
+            for (uint8_t layer = 0; layer < sparse_keymap_layer_count; ++layer) {
+                for (uint8_t row = 0; row < MATRIX_ROWS; ++row) {
+                    for (uint8_t col = 0; col < MATRIX_COLS; ++col) {
+                        sum += sparse ? keycode_at_keymap_location(layer, row, col) : keycode_at_keymap_location_raw(layer, row, col);
+                    }
+                }
+            }
+        }
+        elapsed[sparse] = timing_elapsed_us(start);
+        sink += sum;
+    }
+    uprintf("sparse keymap: %lu lookups, dense %lu us, sparse %lu us, %u mismatches\n", (uint32_t)SPARSE_KEYMAP_BENCHMARK_ROUNDS * sparse_keymap_layer_count * MATRIX_ROWS * MATRIX_COLS, elapsed[0], elapsed[1], mismatches);
+}
+#endif // SPARSE_KEYMAP_BENCHMARK
@@ -0,0 +1,74 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <stdint.h>
+#include "quantum.h"
+
+/*
+ * Sparse keymap storage.
+ *
+ * `sparse_keymap.py` turns the keymap's `keymaps` array into the tables below
+ * at build time, and `keycode_at_keymap_location` is replaced by a lookup in
+ * these tables.  The dense array is then no longer referenced, and is dropped
+ * by the linker.
+ *
+ * Each layer has a fill keycode (`KC_NO` or `KC_TRNS`).  For each row of a
+ * layer, a mask has the bit of each column whose keycode is not the fill
+ * keycode set; these keycodes are packed in `sparse_keymap_keycodes`, the
+ * layer's keycodes starting at its layer offset and the row's keycodes at its
+ * row offset from there.
+ */
+
+#if MATRIX_COLS <= 8
+typedef uint8_t sparse_keymap_mask_t;
+#    define pgm_read_sparse_keymap_mask(address) pgm_read_byte(address)
+#elif MATRIX_COLS <= 16
+typedef uint16_t sparse_keymap_mask_t;
+#    define pgm_read_sparse_keymap_mask(address) pgm_read_word(address)
+#else
+typedef uint32_t sparse_keymap_mask_t;
+#    define pgm_read_sparse_keymap_mask(address) pgm_read_dword(address)
+#endif
+
+// Generated, see `sparse_keymap.py`.
+extern const uint16_t             sparse_keymap_fill[];
+extern const uint16_t             sparse_keymap_layer_offsets[];
+extern const uint8_t              sparse_keymap_row_offsets[][MATRIX_ROWS];
+extern const sparse_keymap_mask_t sparse_keymap_masks[][MATRIX_ROWS];
+extern const uint16_t             sparse_keymap_keycodes[];
+extern const uint8_t              sparse_keymap_layer_count;
+
+#ifdef SPARSE_KEYMAP_BENCHMARK
+#    ifndef SPARSE_KEYMAP_BENCHMARK_DELAY_MS
+/** \brief Time to wait after startup before running the benchmark, so that the console is up. */
+#        define SPARSE_KEYMAP_BENCHMARK_DELAY_MS 5000
+#    endif // SPARSE_KEYMAP_BENCHMARK_DELAY_MS
+
+#    ifndef SPARSE_KEYMAP_BENCHMARK_ROUNDS
+/** \brief Number of times every key of every layer is looked up. */
+#        define SPARSE_KEYMAP_BENCHMARK_ROUNDS 100
+#    endif // SPARSE_KEYMAP_BENCHMARK_ROUNDS
+
+/**
+ * \brief Compare the sparse and dense lookups, once.
+ *
+ * Checks that both return the same keycodes, and prints how long each takes to
+ * look up every key of every layer.  Keeps the dense array in the firmware.
+ */
+void sparse_keymap_benchmark_task(void);
+#endif // SPARSE_KEYMAP_BENCHMARK
@@ -0,0 +1,221 @@
+#!/usr/bin/env python3
+# Copyright 2026 eddieurfaust (@eddieurfaust)
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+"""Generate the sparse representation of a keymap's `keymaps` array.
+
+Every `[layer] = LAYOUT(...)` of the keymap is mapped onto the matrix using the
+keyboard's layout definition (from `qmk info`).  For each layer, the most common
+of `KC_NO` and `KC_TRNS` becomes the layer's fill keycode; the other keycodes
+are stored in a packed array, and a per-row column mask tells which positions
+are stored.  Keycodes are copied as written, so the generated header must be
+included from `keymap.c` after `keymaps`.
+
+Prints the flash used by each layer in both representations.
+"""
+import argparse
+import json
+import re
+import subprocess
+import sys
+from pathlib import Path
+
+KC_NO = ('KC_NO', 'XXXXXXX')
+KC_TRNS = ('KC_TRNS', 'KC_TRANSPARENT', '_______')
+
+
+def strip_comments(source):
+    return re.sub(r'//[^\n]*|/\*.*?\*/', ' ', source, flags=re.S)
+
+
+def matching_paren(source, start):
+    """Return the index of the parenthesis closing the one at `start`."""
+    depth = 0
+    for i in range(start, len(source)):
+        if source[i] == '(':
+            depth += 1
+        elif source[i] == ')':
+            depth -= 1
+            if depth == 0:
+                return i
+    raise ValueError('unbalanced parentheses')
+
+
+def split_arguments(arguments):
+    """Split macro arguments on the commas that are not nested in parentheses."""
+    result, depth, current = [], 0, ''
+    for char in arguments:
+        if char == ',' and depth == 0:
+            result.append(current.strip())
+            current = ''
+            continue
+        depth += char == '('
+        depth -= char == ')'
+        current += char
+    if current.strip():
+        result.append(current.strip())
+    return result
+
+
+def parse_layers(keymap_c):
+    """Return the `(designator, layout, keycodes)` of each layer of `keymaps`."""
+    source = strip_comments(keymap_c)
+    match = re.search(r'\bkeymaps\s*\[\s*\]\s*\[\s*MATRIX_ROWS\s*\]\s*\[\s*MATRIX_COLS\s*\]\s*=\s*\{', source)
+    if not match:
+        raise ValueError('no keymaps[][MATRIX_ROWS][MATRIX_COLS] array found')
+    layers, position = [], match.end()
+    layer_re = re.compile(r'\s*(?:\[\s*(\w+)\s*\]\s*=\s*)?(\w+)\s*\(')
+    while True:
+        layer = layer_re.match(source, position)
+        if not layer:
+            break
+        end = matching_paren(source, layer.end() - 1)
+        designator = layer.group(1) or str(len(layers))
+        layers.append((designator, layer.group(2), split_arguments(source[layer.end():end])))
+        position = end + 1
+        separator = re.compile(r'\s*,').match(source, position)
+        if not separator:
+            break
+        position = separator.end()
+    return layers
+
+
+def load_info(args):
+    if args.info:
+        return json.loads(Path(args.info).read_text())
+    output = subprocess.run(['qmk', 'info', '-kb', args.keyboard, '-f', 'json'], check=True, capture_output=True, text=True).stdout
+    return json.loads(output)
+
+
+def layout_matrix(info, name):
+    """Return the matrix position of each key of a layout macro."""
+    name = info.get('layout_aliases', {}).get(name, name)
+    if name not in info['layouts']:
+        raise ValueError(f'unknown layout {name}')
+    return [tuple(key['matrix']) for key in info['layouts'][name]['layout']]
+
+
+def fill_keycode(keycodes):
+    no = sum(keycode in KC_NO for keycode in keycodes)
+    trns = sum(keycode in KC_TRNS for keycode in keycodes)
+    return 'KC_TRNS' if trns > no else 'KC_NO'
+
+
+def is_fill(keycode, fill):
+    return keycode in (KC_TRNS if fill == 'KC_TRNS' else KC_NO)
+
+
+def generate(layers, info, source_name):
+    rows, cols = info['matrix_size']['rows'], info['matrix_size']['cols']
+    mask_bytes = 1 if cols <= 8 else 2 if cols <= 16 else 4
+    fills, masks, row_offsets, layer_offsets, keycodes, report = [], [], [], [], [], []
+
+    for designator, layout, layer_keycodes in layers:
+        matrix = layout_matrix(info, layout)
+        if len(matrix) != len(layer_keycodes):
+            raise ValueError(f'layer {designator}: {layout} takes {len(matrix)} keys, got {len(layer_keycodes)}')
+        # Positions missing from the layout are KC_NO in the dense array.
+        dense = [['KC_NO'] * cols for _ in range(rows)]
+        for (row, col), keycode in zip(matrix, layer_keycodes):
+            dense[row][col] = keycode
+        fill = fill_keycode([keycode for row in dense for keycode in row])
+
+        layer_offsets.append(len(keycodes))
+        layer_masks, layer_row_offsets, stored = [], [], 0
+        for row in range(rows):
+            mask = 0
+            layer_row_offsets.append(stored)
+            for col in range(cols):
+                if not is_fill(dense[row][col], fill):
+                    mask |= 1 << col
+                    keycodes.append(dense[row][col])
+                    stored += 1
+            layer_masks.append(mask)
+        if stored > 255:
+            raise ValueError(f'layer {designator}: too many keycodes')
+        fills.append(fill)
+        masks.append(layer_masks)
+        row_offsets.append(layer_row_offsets)
+
+        dense_size = rows * cols * 2
+        sparse_size = 2 + 2 + rows * (mask_bytes + 1) + stored * 2
+        report.append((designator, dense_size, sparse_size))
+
+    def table(values):
+        return '\n'.join(f'    [{designator}] = {value},' for (designator, _, _), value in zip(layers, values))
+
+    def rows_of(values, width):
+        return ['{' + ', '.join(f'0x{value:0{width}x}' if width else str(value) for value in row) + '}' for row in values]
+
+    lines = [
+        f'// Generated by sparse_keymap.py from {source_name}, do not edit.',
+        '//',
+    ] + [f'// {designator}: {dense_size} bytes dense, {sparse_size} bytes sparse.' for designator, dense_size, sparse_size in report] + [
+        '',
+        '#pragma once',
+        '',
+        '#include "sparse_keymap.h"',
+        '',
+        '// clang-format off',
+        'const uint16_t PROGMEM sparse_keymap_fill[] = {',
+        table(fills),
+        '};',
+        '',
+        'const uint16_t PROGMEM sparse_keymap_layer_offsets[] = {',
+        table(layer_offsets),
+        '};',
+        '',
+        'const uint8_t PROGMEM sparse_keymap_row_offsets[][MATRIX_ROWS] = {',
+        table(rows_of(row_offsets, 0)),
+        '};',
+        '',
+        'const sparse_keymap_mask_t PROGMEM sparse_keymap_masks[][MATRIX_ROWS] = {',
+        table(rows_of(masks, mask_bytes * 2)),
+        '};',
+        '',
+        'const uint16_t PROGMEM sparse_keymap_keycodes[] = {',
+        '    ' + ', '.join(keycodes),
+        '};',
+        '// clang-format on',
+        '',
+        'const uint8_t sparse_keymap_layer_count = ARRAY_SIZE(sparse_keymap_fill);',
+        '',
+    ]
+    return '\n'.join(lines), report
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('keymap_c', help='keymap.c to read the layers from')
+    parser.add_argument('-kb', '--keyboard', help='keyboard to read the layouts of, with `qmk info`')
+    parser.add_argument('--info', help='read the layouts from this info.json instead of running `qmk info`')
+    parser.add_argument('-o', '--output', required=True, help='header to write')
+    args = parser.parse_args()
+    if not args.keyboard and not args.info:
+        parser.error('one of --keyboard or --info is required')
+
+    keymap_c = Path(args.keymap_c)
+    layers = parse_layers(keymap_c.read_text())
+    header, report = generate(layers, load_info(args), keymap_c.name)
+    Path(args.output).write_text(header)
+
+    dense_total = sum(dense for _, dense, _ in report)
+    sparse_total = sum(sparse for _, _, sparse in report)
+    for designator, dense, sparse in report:
+        print(f'{designator:24} {dense:5} B dense {sparse:5} B sparse {dense - sparse:5} B saved')
+    print(f'{"total":24} {dense_total:5} B dense {sparse_total:5} B sparse {dense_total - sparse_total:5} B saved')
+
+
+if __name__ == '__main__':
+    sys.exit(main())
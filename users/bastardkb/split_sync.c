@@ -0,0 +1,188 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <string.h>
+#include "split_sync.h"
+#include "quantum.h"
+#include "transactions.h"
+
+#if SPLIT_SYNC_MAX_FIELDS > 8
+#    error "SPLIT_SYNC_MAX_FIELDS must be at most 8"
+#endif
+
+/** \brief Transaction header: sequence number and field mask. */
+#define SPLIT_SYNC_HEADER_SIZE 2
+
+/**
+ * \brief Bytes QMK's `transaction_rpc_exec` exchanges besides the request.
+ *
+ * The RPC info (transaction ID, request and response lengths, checksum), the
+ * transaction ID of the execute command and the 1-byte acknowledgement.
+ */
+#define SPLIT_SYNC_RPC_OVERHEAD (4 + 1 + 1)
+
+typedef struct {
+    uint8_t *data;
+    uint8_t  offset; // Offset of the field in `split_sync_sent`.
+    uint8_t  size;
+} split_sync_field_t;
+
+static split_sync_field_t split_sync_fields[SPLIT_SYNC_MAX_FIELDS];
+static uint8_t            split_sync_field_count = 0;
+
+/** \brief Values last acknowledged by the secondary half. */
+static uint8_t split_sync_sent[SPLIT_SYNC_MAX_SIZE];
+static uint8_t split_sync_sent_size = 0;
+
+/** \brief Fields to send even if unchanged. */
+static uint8_t  split_sync_pending      = 0;
+static uint8_t  split_sync_sequence     = 0;
+static uint32_t split_sync_forced_timer = 0;
+
+/** \brief Delay before the next transaction after a failure, 0 after a success. */
+static uint32_t split_sync_retry_delay = 0;
+static uint32_t split_sync_retry_timer = 0;
+
+static split_sync_stats_t split_sync_stats        = {0};
+static split_sync_stats_t split_sync_stats_window = {0};
+static uint32_t           split_sync_stats_timer  = 0;
+
+__attribute__((weak)) void split_sync_received_keymap(uint8_t fields) {}
+
+int8_t split_sync_register(void *data, uint8_t size) {
+    if (split_sync_field_count >= SPLIT_SYNC_MAX_FIELDS || split_sync_sent_size + size > SPLIT_SYNC_MAX_SIZE || size > RPC_M2S_BUFFER_SIZE - SPLIT_SYNC_HEADER_SIZE) {
+        return -1;
+    }
+    split_sync_fields[split_sync_field_count] = (split_sync_field_t){.data = data, .offset = split_sync_sent_size, .size = size};
+    split_sync_sent_size += size;
+    split_sync_pending |= 1 << split_sync_field_count;
+    return split_sync_field_count++;
+}
+
+split_sync_stats_t split_sync_stats_get(void) {
+    return split_sync_stats;
+}
+
+static void split_sync_slave_handler(uint8_t in_buflen, const void *in_data, uint8_t out_buflen, void *out_data) {
+    const uint8_t *buffer = in_data;
+    if (in_buflen < SPLIT_SYNC_HEADER_SIZE) {
+        return;
+    }
+    uint8_t mask     = buffer[1];
+    uint8_t position = SPLIT_SYNC_HEADER_SIZE;
+    for (uint8_t i = 0; i < split_sync_field_count; ++i) {
+        if (!(mask & (1 << i))) {
+            continue;
+        }
+        const split_sync_field_t *field = &split_sync_fields[i];
+        if (position + field->size > in_buflen) {
+            // The halves registered different fields, do not acknowledge.
+            return;
+        }
+        memcpy(field->data, &buffer[position], field->size);
+        position += field->size;
+    }
+    *(uint8_t *)out_data = buffer[0];
+    split_sync_received_keymap(mask);
+}
+
+void split_sync_init(void) {
+    transaction_register_rpc(USERSPACE_SPLIT_SYNC, split_sync_slave_handler);
+    split_sync_forced_timer = timer_read32();
+    split_sync_stats_timer  = split_sync_forced_timer;
+}
+
+static void split_sync_stats_task(void) {
+    if (timer_elapsed32(split_sync_stats_timer) < SPLIT_SYNC_STATS_INTERVAL_MS) {
+        return;
+    }
+    split_sync_stats_timer  = timer_read32();
+    split_sync_stats        = split_sync_stats_window;
+    split_sync_stats_window = (split_sync_stats_t){0};
+    dprintf("split sync: %lu B/s, %lu transfers, %lu skipped, %lu failed\n", (unsigned long)split_sync_stats.bytes, (unsigned long)split_sync_stats.transfers, (unsigned long)split_sync_stats.skipped, (unsigned long)split_sync_stats.failures);
+}
+
+void split_sync_task(void) {
+    if (!is_keyboard_master() || split_sync_field_count == 0) {
+        return;
+    }
+    split_sync_stats_task();
+    // Back off while the secondary half does not answer, eg. while it is unplugged.
+    if (split_sync_retry_delay > 0 && timer_elapsed32(split_sync_retry_timer) < split_sync_retry_delay) {
+        return;
+    }
+
+    uint8_t mask = split_sync_pending;
+    if (timer_elapsed32(split_sync_forced_timer) >= SPLIT_SYNC_FORCED_SYNC_MS) {
+        split_sync_forced_timer = timer_read32();
+        mask                    = (1 << split_sync_field_count) - 1;
+    }
+    for (uint8_t i = 0; i < split_sync_field_count; ++i) {
+        const split_sync_field_t *field = &split_sync_fields[i];
+        if (memcmp(field->data, &split_sync_sent[field->offset], field->size) != 0) {
+            mask |= 1 << i;
+        }
+    }
+    if (mask == 0) {
+        ++split_sync_stats_window.skipped;
+        return;
+    }
+
+    // Fields that do not fit in this transaction are sent in the next one.
+    uint8_t buffer[RPC_M2S_BUFFER_SIZE];
+    uint8_t size = SPLIT_SYNC_HEADER_SIZE;
+    uint8_t sent = 0;
+    for (uint8_t i = 0; i < split_sync_field_count; ++i) {
+        const split_sync_field_t *field = &split_sync_fields[i];
+        if (!(mask & (1 << i)) || size + field->size > sizeof(buffer)) {
+            continue;
+        }
+        memcpy(&buffer[size], field->data, field->size);
+        size += field->size;
+        sent |= 1 << i;
+    }
+    buffer[0] = ++split_sync_sequence;
+    buffer[1] = sent;
+
+    uint8_t acknowledged = split_sync_sequence - 1;
+    ++split_sync_stats_window.transfers;
+    split_sync_stats_window.bytes += size + SPLIT_SYNC_RPC_OVERHEAD;
+    if (!transaction_rpc_exec(USERSPACE_SPLIT_SYNC, size, buffer, sizeof(acknowledged), &acknowledged) || acknowledged != split_sync_sequence) {
+        ++split_sync_stats_window.failures;
+        split_sync_pending     = mask;
+        split_sync_retry_timer = timer_read32();
+        if (split_sync_retry_delay == 0) {
+            split_sync_retry_delay = SPLIT_SYNC_RETRY_MS;
+        } else if (split_sync_retry_delay < SPLIT_SYNC_FORCED_SYNC_MS) {
+            split_sync_retry_delay *= 2;
+            if (split_sync_retry_delay > SPLIT_SYNC_FORCED_SYNC_MS) {
+                split_sync_retry_delay = SPLIT_SYNC_FORCED_SYNC_MS;
+            }
+        }
+        return;
+    }
+    split_sync_pending     = mask & ~sent;
+    split_sync_retry_delay = 0;
+
+    size = SPLIT_SYNC_HEADER_SIZE;
+    for (uint8_t i = 0; i < split_sync_field_count; ++i) {
+        const split_sync_field_t *field = &split_sync_fields[i];
+        if (sent & (1 << i)) {
+            memcpy(&split_sync_sent[field->offset], &buffer[size], field->size);
+            size += field->size;
+        }
+    }
+}
@@ -0,0 +1,93 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Delta-compressed sync of custom state from the primary half to the secondary
+ * half of a split keyboard.
+ *
+ * State is registered as fields (plain variables, up to
+ * `SPLIT_SYNC_MAX_FIELDS`), in the same order on both halves.  On every loop
+ * iteration, the primary half compares each field against the value last sent
+ * and sends only the fields that changed, in a single transaction made of a
+ * sequence number, a bitmask of the fields included and their values.  When
+ * nothing changed, no transaction is made.
+ *
+ * The secondary half acknowledges the sequence number; fields of a failed or
+ * unacknowledged transaction are sent again, after `SPLIT_SYNC_RETRY_MS`,
+ * doubled after each further failure up to `SPLIT_SYNC_FORCED_SYNC_MS`.  All
+ * fields are also resent every `SPLIT_SYNC_FORCED_SYNC_MS`, in case the
+ * secondary half was reset.
+ */
+
+#ifndef SPLIT_SYNC_MAX_FIELDS
+/** \brief Maximum number of fields, at most 8. */
+#    define SPLIT_SYNC_MAX_FIELDS 8
+#endif // SPLIT_SYNC_MAX_FIELDS
+
+#ifndef SPLIT_SYNC_MAX_SIZE
+/** \brief Total size of all the fields, in bytes. */
+#    define SPLIT_SYNC_MAX_SIZE 16
+#endif // SPLIT_SYNC_MAX_SIZE
+
+#ifndef SPLIT_SYNC_FORCED_SYNC_MS
+/** \brief Interval at which all the fields are resent, even if unchanged. */
+#    define SPLIT_SYNC_FORCED_SYNC_MS 1000
+#endif // SPLIT_SYNC_FORCED_SYNC_MS
+
+#ifndef SPLIT_SYNC_RETRY_MS
+/** \brief Delay before the first retry of a failed transaction. */
+#    define SPLIT_SYNC_RETRY_MS 8
+#endif // SPLIT_SYNC_RETRY_MS
+
+#ifndef SPLIT_SYNC_STATS_INTERVAL_MS
+/** \brief Length of the window over which the transfer statistics are computed. */
+#    define SPLIT_SYNC_STATS_INTERVAL_MS 1000
+#endif // SPLIT_SYNC_STATS_INTERVAL_MS
+
+/** \brief Transfer statistics of the last window. */
+typedef struct {
+    uint32_t bytes;     // Bytes exchanged with the secondary half, headers and RPC overhead included.
+    uint32_t transfers; // Transactions made.
+    uint32_t skipped;   // Loop iterations without any change to send.
+    uint32_t failures;  // Failed or unacknowledged transactions.
+} split_sync_stats_t;
+
+/**
+ * \brief Register a field to sync.
+ *
+ * Must be called on both halves, in the same order, eg. from
+ * `keyboard_post_init_keymap`.  Returns the index of the field, which is its
+ * bit in the mask passed to `split_sync_received_keymap`, or -1 if there is no
+ * room left.
+ */
+int8_t split_sync_register(void *data, uint8_t size);
+
+/**
+ * \brief Called on the secondary half after fields were updated.
+ *
+ * `fields` has the bits of the updated fields set.  Optional.
+ */
+void split_sync_received_keymap(uint8_t fields);
+
+split_sync_stats_t split_sync_stats_get(void);
+
+void split_sync_init(void);
+void split_sync_task(void);
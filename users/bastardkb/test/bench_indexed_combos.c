@@ -0,0 +1,331 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdio.h>
+#include "bastardkb.h"
+#include "sim.h"
+
+/*
+ * Cost of the combo engine per key event, with `BENCH_COMBOS` combos of two
+ * keys over 40 keys.
+ *
+ * Feeds the same typing session to `process_indexed_combos` and to a linear
+ * engine, and times each call alone.  The linear engine is the indexed one with
+ * its candidate combos found as QMK's engine finds them: by walking every key
+ * of every combo on each event.  Presses the engines replay are dropped as
+ * soon as they reach `pre_process_record_user`, so neither pays for the rest
+ * of the pipeline.  Built for 14 (handsdownneu), 64 and 256 combos by
+ * `make bench`.
+ */
+
+#ifndef BENCH_COMBOS
+#    define BENCH_COMBOS 14
+#endif // BENCH_COMBOS
+
+_Static_assert(BENCH_COMBOS <= 40 * 19, "Not enough distinct pairs of keys");
+
+// clang-format off
+static const uint16_t keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
+    {
+        {KC_A,    KC_B,    KC_C,    KC_D,    KC_E},
+        {KC_F,    KC_G,    KC_H,    KC_I,    KC_J},
+        {KC_K,    KC_L,    KC_M,    KC_N,    KC_O},
+        {KC_P,    KC_Q,    KC_R,    KC_S,    KC_T},
+        {KC_U,    KC_V,    KC_W,    KC_X,    KC_Y},
+        {KC_Z,    KC_1,    KC_2,    KC_3,    KC_4},
+        {KC_5,    KC_6,    KC_7,    KC_8,    KC_9},
+        {KC_0,    KC_MINS, KC_EQL,  KC_LBRC, KC_RBRC},
+    },
+};
+// clang-format on
+
+#define BENCH_KEYS (MATRIX_ROWS * MATRIX_COLS)
+
+static uint16_t combo_keys[BENCH_COMBOS][3];
+combo_t         key_combos[BENCH_COMBOS];
+const uint16_t  key_combos_count = BENCH_COMBOS;
+
+static uint16_t bench_keycode(uint16_t key) {
+    return keymaps[0][key / MATRIX_COLS][key % MATRIX_COLS];
+}
+
+/** \brief Combo `i` pairs key `i % 40` with the key `1 + i / 40` keys after it. */
+static void bench_combos_init(void) {
+    for (uint16_t i = 0; i < BENCH_COMBOS; ++i) {
+        uint16_t key     = i % BENCH_KEYS;
+        combo_keys[i][0] = bench_keycode(key);
+        combo_keys[i][1] = bench_keycode((key + 1 + i / BENCH_KEYS) % BENCH_KEYS);
+        combo_keys[i][2] = COMBO_END;
+        key_combos[i]    = (combo_t)COMBO(combo_keys[i], KC_ENT);
+    }
+}
+
+static uint32_t bench_random = 1;
+
+static uint32_t bench_next(uint32_t range) {
+    bench_random = bench_random * 1103515245 + 12345;
+    return (bench_random >> 16) % range;
+}
+
+static sim_event_t bench_events[20000];
+
+/** \brief Taps of random keys, one in five pressed together with the next key. */
+static void bench_events_init(void) {
+    uint32_t time = 0;
+    for (size_t i = 0; i < ARRAY_SIZE(bench_events); i += 2) {
+        uint16_t key     = bench_next(BENCH_KEYS);
+        bool     rolled  = i + 4 <= ARRAY_SIZE(bench_events) && bench_next(5) == 0;
+        uint16_t next    = (key + 1) % BENCH_KEYS;
+        uint8_t  row     = key / MATRIX_COLS, col = key % MATRIX_COLS;
+        time += 40 + bench_next(120);
+        bench_events[i] = (sim_event_t){.time = time, .row = row, .col = col, .pressed = true};
+        if (rolled) {
+            bench_events[i + 1] = (sim_event_t){.time = time + 10, .row = next / MATRIX_COLS, .col = next % MATRIX_COLS, .pressed = true};
+            time += 60;
+            bench_events[i + 2] = (sim_event_t){.time = time, .row = row, .col = col, .pressed = false};
+            bench_events[i + 3] = (sim_event_t){.time = time, .row = next / MATRIX_COLS, .col = next % MATRIX_COLS, .pressed = false};
+            i += 2;
+        } else {
+            time += 30 + bench_next(60);
+            bench_events[i + 1] = (sim_event_t){.time = time, .row = row, .col = col, .pressed = false};
+        }
+    }
+}
+
+/* Linear engine */
+
+static struct {
+    keyevent_t event;
+    uint16_t   keycode;
+} linear_buffer[INDEXED_COMBO_MAX_LENGTH];
+static uint8_t  linear_buffer_length = 0;
+static uint16_t linear_buffer_timer  = 0;
+static int16_t  linear_buffer_match  = -1;
+
+static struct {
+    uint16_t combo;
+    uint8_t  length;
+    uint8_t  released;
+    keypos_t keys[INDEXED_COMBO_MAX_LENGTH];
+} linear_active[INDEXED_COMBO_MAX_ACTIVE];
+static uint8_t linear_active_length = 0;
+
+static bool linear_combo_has(uint16_t combo, uint16_t keycode, uint8_t *length) {
+    const uint16_t *keys  = key_combos[combo].keys;
+    bool            found = false;
+    uint16_t        key;
+    uint8_t         i = 0;
+    for (; (key = pgm_read_word(&keys[i])) != COMBO_END; ++i) {
+        found |= key == keycode;
+    }
+    *length = i;
+    return found;
+}
+
+static void linear_fire(uint16_t combo) {
+    if (linear_active_length < INDEXED_COMBO_MAX_ACTIVE) {
+        linear_active[linear_active_length].combo    = combo;
+        linear_active[linear_active_length].length   = linear_buffer_length;
+        linear_active[linear_active_length].released = 0;
+        for (uint8_t i = 0; i < linear_buffer_length; ++i) {
+            linear_active[linear_active_length].keys[i] = linear_buffer[i].event.key;
+        }
+        ++linear_active_length;
+        register_code16(key_combos[combo].keycode);
+    } else {
+        tap_code16(key_combos[combo].keycode);
+    }
+    linear_buffer_length = 0;
+    linear_buffer_match  = -1;
+}
+
+static void linear_flush(void) {
+    if (linear_buffer_length == 0) {
+        return;
+    }
+    if (linear_buffer_match >= 0) {
+        linear_fire(linear_buffer_match);
+        return;
+    }
+    uint8_t length       = linear_buffer_length;
+    linear_buffer_length = 0;
+    for (uint8_t i = 0; i < length; ++i) {
+        action_exec(linear_buffer[i].event);
+    }
+}
+
+/** \brief Walk every combo: whether a longer one could complete, and the exact match. */
+static bool linear_match(void) {
+    bool partial        = false;
+    linear_buffer_match = -1;
+    for (uint16_t combo = 0; combo < key_combos_count; ++combo) {
+        bool    contains = true;
+        uint8_t length   = 0;
+        for (uint8_t i = 0; i < linear_buffer_length && contains; ++i) {
+            contains = linear_combo_has(combo, linear_buffer[i].keycode, &length);
+        }
+        if (!contains || length < linear_buffer_length) {
+            continue;
+        }
+        if (length == linear_buffer_length) {
+            if (linear_buffer_match < 0) {
+                linear_buffer_match = combo;
+            }
+        } else {
+            partial = true;
+        }
+    }
+    return partial;
+}
+
+static bool linear_release(keypos_t key) {
+    for (uint8_t i = 0; i < linear_active_length; ++i) {
+        for (uint8_t j = 0; j < linear_active[i].length; ++j) {
+            if (!KEYEQ(linear_active[i].keys[j], key)) {
+                continue;
+            }
+            if (linear_active[i].released++ == 0) {
+                unregister_code16(key_combos[linear_active[i].combo].keycode);
+            }
+            linear_active[i].keys[j] = (keypos_t){.row = UINT8_MAX, .col = UINT8_MAX};
+            if (linear_active[i].released == linear_active[i].length) {
+                linear_active[i] = linear_active[--linear_active_length];
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool process_linear_combos(uint16_t keycode, keyrecord_t *record) {
+    if (!record->event.pressed) {
+        linear_flush();
+        return !linear_release(record->event.key);
+    }
+    bool    in_combo = false;
+    uint8_t length;
+    for (uint16_t combo = 0; combo < key_combos_count && !in_combo; ++combo) {
+        in_combo = linear_combo_has(combo, keycode, &length);
+    }
+    if (!in_combo) {
+        linear_flush();
+        return true;
+    }
+    if (linear_buffer_length == INDEXED_COMBO_MAX_LENGTH) {
+        linear_flush();
+    }
+    if (linear_buffer_length == 0) {
+        linear_buffer_timer = timer_read();
+    }
+    linear_buffer[linear_buffer_length].event   = record->event;
+    linear_buffer[linear_buffer_length].keycode = keycode;
+    ++linear_buffer_length;
+
+    int16_t previous_match = linear_buffer_match;
+    bool    partial        = linear_match();
+    if (!partial && linear_buffer_match < 0 && linear_buffer_length > 1) {
+        --linear_buffer_length;
+        linear_buffer_match = previous_match;
+        linear_flush();
+        linear_buffer[0].event   = record->event;
+        linear_buffer[0].keycode = keycode;
+        linear_buffer_length     = 1;
+        linear_buffer_timer      = timer_read();
+        partial                  = linear_match();
+    }
+    if (!partial && linear_buffer_match >= 0) {
+        linear_fire(linear_buffer_match);
+    }
+    return false;
+}
+
+static void linear_combos_task(void) {
+    if (linear_buffer_length > 0 && timer_elapsed(linear_buffer_timer) > COMBO_TERM) {
+        linear_flush();
+    }
+}
+
+/* Benchmark */
+
+static size_t bench_replayed = 0;
+
+/** \brief Drop the presses replayed by the engines, before the indexed engine sees them. */
+bool pre_process_record_keymap(uint16_t keycode, keyrecord_t *record) {
+    ++bench_replayed;
+    return false;
+}
+
+typedef struct {
+    uint64_t ns;
+    size_t   passed;   // Events passed on to the rest of the pipeline.
+    size_t   replayed; // Buffered presses replayed.
+    size_t   reports;  // Reports sent by fired combos.
+} bench_result_t;
+
+/** \brief Feed the events to `engine`, timing each call.  `task` runs every millisecond, if not NULL. */
+static bench_result_t bench_run(bool (*engine)(uint16_t, keyrecord_t *), void (*task)(void), uint64_t overhead_ns) {
+    SIM_INIT(keymaps);
+    bench_replayed        = 0;
+    bench_result_t result = {0};
+    uint32_t       start  = sim_now();
+    for (size_t i = 0; i < ARRAY_SIZE(bench_events); ++i) {
+        const sim_event_t *event = &bench_events[i];
+        while (sim_now() < start + event->time) {
+            sim_tick(1);
+            if (task != NULL) {
+                task();
+            }
+        }
+        keyrecord_t record  = {.event = {.key = {.row = event->row, .col = event->col}, .time = timer_read(), .type = KEY_EVENT, .pressed = event->pressed}};
+        uint16_t    keycode = keymaps[0][event->row][event->col];
+        uint64_t    begin   = sim_clock_ns();
+        bool        passed  = engine(keycode, &record);
+        result.ns += sim_clock_ns() - begin - overhead_ns;
+        result.passed += passed;
+    }
+    sim_tick(COMBO_TERM + 1);
+    if (task != NULL) {
+        task();
+    }
+    result.replayed = bench_replayed;
+    result.reports  = sim_report_count;
+    return result;
+}
+
+/** \brief Cost of reading the clock twice, subtracted from each timed call. */
+static uint64_t bench_clock_overhead(void) {
+    uint64_t begin = sim_clock_ns();
+    for (int i = 0; i < 100000; ++i) {
+        (void)sim_clock_ns();
+    }
+    return (sim_clock_ns() - begin) / 100000;
+}
+
+int main(void) {
+    bench_combos_init();
+    bench_events_init();
+
+    uint64_t       overhead = bench_clock_overhead();
+    bench_result_t indexed  = bench_run(process_indexed_combos, NULL, overhead);
+    bench_result_t linear   = bench_run(process_linear_combos, linear_combos_task, overhead);
+
+    printf("  %3u combos: indexed %5.1f ns/event, linear %6.1f ns/event\n", BENCH_COMBOS, (double)indexed.ns / ARRAY_SIZE(bench_events), (double)linear.ns / ARRAY_SIZE(bench_events));
+    if (indexed.passed != linear.passed || indexed.replayed != linear.replayed || indexed.reports != linear.reports) {
+        fprintf(stderr, "bench: the engines disagree: %zu/%zu/%zu events passed/replayed/reports, against %zu/%zu/%zu\n", indexed.passed, indexed.replayed, indexed.reports, linear.passed, linear.replayed, linear.reports);
+        return 1;
+    }
+    return 0;
+}
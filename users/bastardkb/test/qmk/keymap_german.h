@@ -0,0 +1,68 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "quantum.h"
+
+/* German host layout keycodes, as QMK's `keymap_extras/keymap_german.h`. */
+
+#define DE_CIRC KC_GRAVE
+#define DE_1 KC_1
+#define DE_2 KC_2
+#define DE_3 KC_3
+#define DE_4 KC_4
+#define DE_5 KC_5
+#define DE_6 KC_6
+#define DE_7 KC_7
+#define DE_8 KC_8
+#define DE_9 KC_9
+#define DE_0 KC_0
+#define DE_SS KC_MINUS
+#define DE_ACUT KC_EQUAL
+#define DE_Z KC_Y
+#define DE_UDIA KC_LEFT_BRACKET
+#define DE_PLUS KC_RIGHT_BRACKET
+#define DE_ODIA KC_SEMICOLON
+#define DE_ADIA KC_QUOTE
+#define DE_HASH KC_NONUS_HASH
+#define DE_LABK KC_NONUS_BACKSLASH
+#define DE_Y KC_Z
+#define DE_COMM KC_COMMA
+#define DE_DOT KC_DOT
+#define DE_MINS KC_SLASH
+
+#define DE_EXLM S(DE_1)
+#define DE_DQUO S(DE_2)
+#define DE_DLR S(DE_4)
+#define DE_PERC S(DE_5)
+#define DE_AMPR S(DE_6)
+#define DE_SLSH S(DE_7)
+#define DE_LPRN S(DE_8)
+#define DE_RPRN S(DE_9)
+#define DE_EQL S(DE_0)
+#define DE_QUES S(DE_SS)
+#define DE_ASTR S(DE_PLUS)
+#define DE_UNDS S(DE_MINS)
+
+#define DE_LCBR ALGR(DE_7)
+#define DE_LBRC ALGR(DE_8)
+#define DE_RBRC ALGR(DE_9)
+#define DE_RCBR ALGR(DE_0)
+#define DE_BSLS ALGR(DE_SS)
+#define DE_AT ALGR(KC_Q)
+#define DE_TILD ALGR(DE_PLUS)
+#define DE_PIPE ALGR(DE_LABK)
@@ -0,0 +1,520 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+/*
+ * Host stand-in for the QMK headers used by the userspace.
+ *
+ * Declares the subset of the QMK API the userspace modules call, with the same
+ * names, types and keycode values as QMK.  The functions are implemented by the
+ * simulated keyboard in `../sim.c`.  Every other QMK header included by the
+ * modules forwards to this one.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h> // Before `dprintf` below replaces the POSIX one.
+#include <stdlib.h>
+#include <string.h>
+
+/* Keyboard configuration, overridden with -D by the test Makefile. */
+
+#ifndef MATRIX_ROWS
+/** Split keyboard, 4 rows per half, the last row of each half is the thumb cluster. */
+#    define MATRIX_ROWS 8
+#endif // MATRIX_ROWS
+#ifndef MATRIX_COLS
+#    define MATRIX_COLS 5
+#endif // MATRIX_COLS
+#ifndef TAPPING_TERM
+#    define TAPPING_TERM 200
+#endif // TAPPING_TERM
+#ifndef TAP_CODE_DELAY
+#    define TAP_CODE_DELAY 0
+#endif // TAP_CODE_DELAY
+#ifndef USB_POLLING_INTERVAL_MS
+#    define USB_POLLING_INTERVAL_MS 1
+#endif // USB_POLLING_INTERVAL_MS
+#define MAX_LAYER 16
+
+/* progmem.h, util.h */
+
+#define PROGMEM
+#define pgm_read_byte(p) (*(const uint8_t *)(p))
+#define pgm_read_word(p) (*(const uint16_t *)(p))
+#define pgm_read_dword(p) (*(const uint32_t *)(p))
+#define ARRAY_SIZE(a) (sizeof(a) / sizeof((a)[0]))
+
+/* keycodes.h */
+
+enum {
+    KC_NO              = 0x0000,
+    KC_TRANSPARENT,
+    KC_A               = 0x0004,
+    KC_B,
+    KC_C,
+    KC_D,
+    KC_E,
+    KC_F,
+    KC_G,
+    KC_H,
+    KC_I,
+    KC_J,
+    KC_K,
+    KC_L,
+    KC_M,
+    KC_N,
+    KC_O,
+    KC_P,
+    KC_Q,
+    KC_R,
+    KC_S,
+    KC_T,
+    KC_U,
+    KC_V,
+    KC_W,
+    KC_X,
+    KC_Y,
+    KC_Z,
+    KC_1,
+    KC_2,
+    KC_3,
+    KC_4,
+    KC_5,
+    KC_6,
+    KC_7,
+    KC_8,
+    KC_9,
+    KC_0,
+    KC_ENTER,
+    KC_ESCAPE,
+    KC_BACKSPACE,
+    KC_TAB,
+    KC_SPACE,
+    KC_MINUS,
+    KC_EQUAL,
+    KC_LEFT_BRACKET,
+    KC_RIGHT_BRACKET,
+    KC_BACKSLASH,
+    KC_NONUS_HASH,
+    KC_SEMICOLON,
+    KC_QUOTE,
+    KC_GRAVE,
+    KC_COMMA,
+    KC_DOT,
+    KC_SLASH,
+    KC_CAPS_LOCK,
+    KC_F1,
+    KC_F2,
+    KC_F3,
+    KC_F4,
+    KC_F5,
+    KC_F6,
+    KC_F7,
+    KC_F8,
+    KC_F9,
+    KC_F10,
+    KC_F11,
+    KC_F12,
+    KC_INSERT          = 0x0049,
+    KC_HOME,
+    KC_PAGE_UP,
+    KC_DELETE,
+    KC_END,
+    KC_PAGE_DOWN,
+    KC_RIGHT,
+    KC_LEFT,
+    KC_DOWN,
+    KC_UP,
+    KC_NONUS_BACKSLASH = 0x0064,
+    KC_EXSEL           = 0x00A4,
+    KC_SYSTEM_SLEEP    = 0x00A6,
+    KC_AUDIO_MUTE      = 0x00A8,
+    KC_AUDIO_VOL_UP,
+    KC_AUDIO_VOL_DOWN,
+    KC_MS_UP           = 0x00CD,
+    KC_MS_DOWN,
+    KC_MS_LEFT,
+    KC_MS_RIGHT,
+    KC_MS_BTN1,
+    KC_MS_BTN2,
+    KC_MS_BTN3,
+    KC_MS_WH_UP        = 0x00D9,
+    KC_MS_WH_DOWN,
+    KC_MS_WH_LEFT,
+    KC_MS_WH_RIGHT,
+    KC_LEFT_CTRL       = 0x00E0,
+    KC_LEFT_SHIFT,
+    KC_LEFT_ALT,
+    KC_LEFT_GUI,
+    KC_RIGHT_CTRL,
+    KC_RIGHT_SHIFT,
+    KC_RIGHT_ALT,
+    KC_RIGHT_GUI,
+};
+
+#define XXXXXXX KC_NO
+#define KC_TRNS KC_TRANSPARENT
+#define _______ KC_TRANSPARENT
+#define KC_ENT KC_ENTER
+#define KC_ESC KC_ESCAPE
+#define KC_BSPC KC_BACKSPACE
+#define KC_SPC KC_SPACE
+#define KC_MINS KC_MINUS
+#define KC_EQL KC_EQUAL
+#define KC_LBRC KC_LEFT_BRACKET
+#define KC_RBRC KC_RIGHT_BRACKET
+#define KC_COMM KC_COMMA
+#define KC_PGUP KC_PAGE_UP
+#define KC_PGDN KC_PAGE_DOWN
+#define KC_VOLU KC_AUDIO_VOL_UP
+#define KC_VOLD KC_AUDIO_VOL_DOWN
+#define KC_SLSH KC_SLASH
+#define KC_BTN1 KC_MS_BTN1
+#define KC_BTN2 KC_MS_BTN2
+#define KC_BTN3 KC_MS_BTN3
+#define KC_WH_U KC_MS_WH_UP
+#define KC_WH_D KC_MS_WH_DOWN
+#define KC_WH_L KC_MS_WH_LEFT
+#define KC_WH_R KC_MS_WH_RIGHT
+#define KC_LCTL KC_LEFT_CTRL
+#define KC_LSFT KC_LEFT_SHIFT
+#define KC_LALT KC_LEFT_ALT
+#define KC_LGUI KC_LEFT_GUI
+#define KC_RCTL KC_RIGHT_CTRL
+#define KC_RSFT KC_RIGHT_SHIFT
+#define KC_RALT KC_RIGHT_ALT
+#define KC_RGUI KC_RIGHT_GUI
+
+#define IS_QK_BASIC(kc) ((kc) <= 0x00FF)
+#define IS_BASIC_KEYCODE(kc) ((kc) >= KC_A && (kc) <= KC_EXSEL)
+#define IS_SYSTEM_KEYCODE(kc) ((kc) >= 0x00A5 && (kc) <= 0x00A7)
+#define IS_CONSUMER_KEYCODE(kc) ((kc) >= KC_AUDIO_MUTE && (kc) <= 0x00C2)
+#define IS_MOUSE_KEYCODE(kc) ((kc) >= KC_MS_UP && (kc) <= 0x00DF)
+#define IS_MODIFIER_KEYCODE(kc) ((kc) >= KC_LEFT_CTRL && (kc) <= KC_RIGHT_GUI)
+
+#define QK_MODS 0x0100
+#define QK_MODS_MAX 0x1FFF
+#define QK_LCTL 0x0100
+#define QK_LSFT 0x0200
+#define QK_LALT 0x0400
+#define QK_LGUI 0x0800
+#define QK_RMODS_MIN 0x1000
+#define QK_RALT 0x1400
+#define IS_QK_MODS(kc) ((kc) >= QK_MODS && (kc) <= QK_MODS_MAX)
+#define QK_MODS_GET_MODS(kc) (((kc) >> 8) & 0x1F)
+#define QK_MODS_GET_BASIC_KEYCODE(kc) ((kc) & 0xFF)
+#define LCTL(kc) (QK_LCTL | (kc))
+#define LSFT(kc) (QK_LSFT | (kc))
+#define LALT(kc) (QK_LALT | (kc))
+#define LGUI(kc) (QK_LGUI | (kc))
+#define RALT(kc) (QK_RALT | (kc))
+#define MEH(kc) (QK_LCTL | QK_LSFT | QK_LALT | (kc))
+#define C(kc) LCTL(kc)
+#define S(kc) LSFT(kc)
+#define A(kc) LALT(kc)
+#define ALGR(kc) RALT(kc)
+
+#define QK_MOD_TAP 0x2000
+#define QK_MOD_TAP_MAX 0x3FFF
+#define IS_QK_MOD_TAP(kc) ((kc) >= QK_MOD_TAP && (kc) <= QK_MOD_TAP_MAX)
+#define QK_MOD_TAP_GET_MODS(kc) (((kc) >> 8) & 0x1F)
+#define QK_MOD_TAP_GET_TAP_KEYCODE(kc) ((kc) & 0xFF)
+#define MT(mod, kc) (QK_MOD_TAP | (((mod) & 0x1F) << 8) | ((kc) & 0xFF))
+#define LCTL_T(kc) MT(MOD_LCTL, kc)
+#define LSFT_T(kc) MT(MOD_LSFT, kc)
+#define LALT_T(kc) MT(MOD_LALT, kc)
+#define LGUI_T(kc) MT(MOD_LGUI, kc)
+#define RCTL_T(kc) MT(MOD_RCTL, kc)
+#define RSFT_T(kc) MT(MOD_RSFT, kc)
+#define RALT_T(kc) MT(MOD_RALT, kc)
+#define RGUI_T(kc) MT(MOD_RGUI, kc)
+
+#define QK_LAYER_TAP 0x4000
+#define QK_LAYER_TAP_MAX 0x4FFF
+#define IS_QK_LAYER_TAP(kc) ((kc) >= QK_LAYER_TAP && (kc) <= QK_LAYER_TAP_MAX)
+#define QK_LAYER_TAP_GET_LAYER(kc) (((kc) >> 8) & 0xF)
+#define QK_LAYER_TAP_GET_TAP_KEYCODE(kc) ((kc) & 0xFF)
+#define LT(layer, kc) (QK_LAYER_TAP | (((layer) & 0xF) << 8) | ((kc) & 0xFF))
+
+#define QK_MOMENTARY 0x5220
+#define QK_MOMENTARY_MAX 0x523F
+#define IS_QK_MOMENTARY(kc) ((kc) >= QK_MOMENTARY && (kc) <= QK_MOMENTARY_MAX)
+#define QK_MOMENTARY_GET_LAYER(kc) ((kc) & 0x1F)
+#define MO(layer) (QK_MOMENTARY | ((layer) & 0x1F))
+
+#define QK_ONE_SHOT_MOD 0x52A0
+#define OSM(mod) (QK_ONE_SHOT_MOD | ((mod) & 0x1F))
+
+#define QK_TAP_DANCE 0x5700
+#define QK_TAP_DANCE_MAX 0x57FF
+#define IS_QK_TAP_DANCE(kc) ((kc) >= QK_TAP_DANCE && (kc) <= QK_TAP_DANCE_MAX)
+#define QK_TAP_DANCE_GET_INDEX(kc) ((kc) & 0xFF)
+#define TD(n) (QK_TAP_DANCE | ((n) & 0xFF))
+
+#define QK_KB_0 0x7E00
+#define QK_USER 0x7E40
+#define SAFE_RANGE QK_USER
+
+#ifdef POINTING_DEVICE_ENABLE
+/* charybdis.h, dilemma.h: the keyboards' pointer keycodes, the same on both. */
+
+enum {
+    POINTER_DEFAULT_DPI_FORWARD = QK_KB_0,
+    POINTER_DEFAULT_DPI_REVERSE,
+    POINTER_SNIPING_DPI_FORWARD,
+    POINTER_SNIPING_DPI_REVERSE,
+    SNIPING_MODE,
+    SNIPING_MODE_TOGGLE,
+    DRAGSCROLL_MODE,
+    DRAGSCROLL_MODE_TOGGLE,
+};
+
+#    define SNIPING SNIPING_MODE
+#    define SNP_TOG SNIPING_MODE_TOGGLE
+#    define DRGSCRL DRAGSCROLL_MODE
+#    define DRG_TOG DRAGSCROLL_MODE_TOGGLE
+#endif // POINTING_DEVICE_ENABLE
+
+/* modifiers.h */
+
+#define MOD_LCTL 0x01
+#define MOD_LSFT 0x02
+#define MOD_LALT 0x04
+#define MOD_LGUI 0x08
+#define MOD_RCTL 0x11
+#define MOD_RSFT 0x12
+#define MOD_RALT 0x14
+#define MOD_RGUI 0x18
+#define MOD_BIT(kc) (1 << ((kc) & 0x07))
+#define MOD_MASK_SHIFT (MOD_BIT(KC_LEFT_SHIFT) | MOD_BIT(KC_RIGHT_SHIFT))
+
+/* keyboard.h, action.h */
+
+typedef struct {
+    uint8_t col;
+    uint8_t row;
+} keypos_t;
+
+typedef enum {
+    TICK_EVENT        = 0,
+    KEY_EVENT         = 1,
+    ENCODER_CW_EVENT  = 2,
+    ENCODER_CCW_EVENT = 3,
+    COMBO_EVENT       = 4,
+} keyevent_type_t;
+
+typedef struct {
+    keypos_t        key;
+    uint16_t        time;
+    keyevent_type_t type;
+    bool            pressed;
+} keyevent_t;
+
+typedef struct {
+    bool    interrupted : 1;
+    bool    reserved2 : 1;
+    bool    reserved1 : 1;
+    bool    reserved0 : 1;
+    uint8_t count : 4;
+} tap_t;
+
+typedef struct {
+    keyevent_t event;
+    tap_t      tap;
+} keyrecord_t;
+
+#define KEYLOC_ENCODER_CW 253
+#define KEYLOC_ENCODER_CCW 252
+#define KEYEQ(keya, keyb) ((keya).row == (keyb).row && (keya).col == (keyb).col)
+#define IS_KEYEVENT(event) ((event).type == KEY_EVENT)
+#define IS_ENCODEREVENT(event) ((event).type == ENCODER_CW_EVENT || (event).type == ENCODER_CCW_EVENT)
+
+/* encoder.h, keymap_introspection.h */
+
+#ifdef ENCODER_MAP_ENABLE
+#    ifndef NUM_ENCODERS
+#        define NUM_ENCODERS 1
+#    endif // NUM_ENCODERS
+#    define NUM_DIRECTIONS 2
+#    define ENCODER_CCW_CW(ccw, cw) {(cw), (ccw)}
+
+/** Given by the keymap, with as many layers as `keymaps`. */
+extern const uint16_t encoder_map[][NUM_ENCODERS][NUM_DIRECTIONS];
+#endif // ENCODER_MAP_ENABLE
+
+void action_exec(keyevent_t event);
+bool is_keyboard_master(void);
+bool is_keyboard_left(void);
+
+/* action_layer.h, keymap_common.h */
+
+typedef uint32_t layer_state_t;
+
+extern layer_state_t layer_state;
+extern layer_state_t default_layer_state;
+
+void     layer_on(uint8_t layer);
+void     layer_off(uint8_t layer);
+bool     layer_state_is(uint8_t layer);
+bool     layer_state_cmp(layer_state_t state, uint8_t layer);
+uint8_t  get_highest_layer(layer_state_t state);
+uint8_t  layer_switch_get_layer(keypos_t key);
+uint16_t keymap_key_to_keycode(uint8_t layer, keypos_t key);
+#ifdef SPARSE_KEYMAP_ENABLE
+/** keymap_introspection.h: replaced by the sparse keymap, the simulator reads the keymap through it. */
+uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column);
+#endif // SPARSE_KEYMAP_ENABLE
+
+/* action_util.h, action.h */
+
+void    register_code(uint8_t code);
+void    unregister_code(uint8_t code);
+void    tap_code(uint8_t code);
+void    register_code16(uint16_t code);
+void    unregister_code16(uint16_t code);
+void    tap_code16(uint16_t code);
+void    add_key(uint8_t key);
+void    del_key(uint8_t key);
+void    clear_keys(void);
+uint8_t get_mods(void);
+void    add_mods(uint8_t mods);
+void    del_mods(uint8_t mods);
+uint8_t get_weak_mods(void);
+void    add_weak_mods(uint8_t mods);
+void    del_weak_mods(uint8_t mods);
+void    clear_weak_mods(void);
+void    send_keyboard_report(void);
+
+uint16_t get_tapping_term(uint16_t keycode, keyrecord_t *record);
+bool     get_hold_on_other_key_press(uint16_t keycode, keyrecord_t *record);
+
+/* report.h, host.h, host_driver.h */
+
+typedef struct {
+    uint8_t mods;
+    uint8_t reserved;
+    uint8_t keys[6];
+} report_keyboard_t;
+
+typedef struct {
+    uint8_t mods;
+    uint8_t bits[30];
+} report_nkro_t;
+
+typedef int8_t mouse_xy_report_t;
+typedef int8_t mouse_hv_report_t;
+
+typedef struct {
+    uint8_t           buttons;
+    mouse_xy_report_t x;
+    mouse_xy_report_t y;
+    mouse_hv_report_t v;
+    mouse_hv_report_t h;
+} report_mouse_t;
+
+typedef struct {
+    uint8_t  report_id;
+    uint16_t usage;
+} report_extra_t;
+
+typedef struct {
+    uint8_t (*keyboard_leds)(void);
+    void (*send_keyboard)(report_keyboard_t *report);
+    void (*send_nkro)(report_nkro_t *report);
+    void (*send_mouse)(report_mouse_t *report);
+    void (*send_extra)(report_extra_t *report);
+} host_driver_t;
+
+host_driver_t *host_get_driver(void);
+void           host_set_driver(host_driver_t *driver);
+
+/* timer.h, wait.h */
+
+uint16_t timer_read(void);
+uint32_t timer_read32(void);
+void     wait_ms(uint16_t ms);
+
+#define TIMER_DIFF_16(a, b) (uint16_t)((a) - (b))
+#define TIMER_DIFF_32(a, b) (uint32_t)((a) - (b))
+#define timer_elapsed(last) TIMER_DIFF_16(timer_read(), (last))
+#define timer_elapsed32(last) TIMER_DIFF_32(timer_read32(), (last))
+#define timer_expired(current, future) ((uint16_t)(current - future) < UINT16_MAX / 2)
+#define timer_expired32(current, future) ((uint32_t)(current - future) < UINT32_MAX / 2)
+
+/* print.h: the console is captured by the simulator.  Like QMK's, not format checked. */
+
+int xprintf(const char *format, ...);
+
+#define uprintf xprintf
+
+/* debug.h */
+
+extern bool debug_enable;
+
+#define dprintf(...)              \
+    do {                          \
+        if (debug_enable) {       \
+            xprintf(__VA_ARGS__); \
+        }                         \
+    } while (0)
+
+/* send_string.h */
+
+extern const uint8_t ascii_to_keycode_lut[128];
+extern const uint8_t ascii_to_shift_lut[16];
+extern const uint8_t ascii_to_altgr_lut[16];
+extern const uint8_t ascii_to_dead_lut[16];
+
+#define PGM_LOADBIT(mem, pos) ((pgm_read_byte(&((mem)[(pos) / 8])) >> ((pos) % 8)) & 0x01)
+#define SEND_STRING(string) send_string(string)
+
+void send_string(const char *string);
+
+/* raw_hid.h */
+
+#define RAW_EPSIZE 32
+
+void raw_hid_send(uint8_t *data, uint8_t length);
+
+/* transactions.h: a single half, which also answers the transactions as the secondary half. */
+
+#ifdef SPLIT_KEYBOARD
+#    define RPC_M2S_BUFFER_SIZE 32
+#    define RPC_S2M_BUFFER_SIZE 32
+#    ifndef SPLIT_TRANSACTION_IDS_USER
+#        define SPLIT_TRANSACTION_IDS_USER USERSPACE_SPLIT_SYNC
+#    endif // SPLIT_TRANSACTION_IDS_USER
+
+enum serial_transaction_id {
+    SPLIT_TRANSACTION_IDS_USER,
+    NUM_TRANSACTIONS,
+};
+
+typedef void (*slave_custom_transaction_handler_t)(uint8_t initiator2target_buflen, const void *initiator2target_buf, uint8_t target2initiator_buflen, void *target2initiator_buf);
+
+void transaction_register_rpc(int8_t transaction_id, slave_custom_transaction_handler_t handler);
+bool transaction_rpc_exec(int8_t transaction_id, uint8_t initiator2target_buflen, const void *initiator2target_buf, uint8_t target2initiator_buflen, void *target2initiator_buf);
+#endif // SPLIT_KEYBOARD
+
+#ifdef TAP_DANCE_ENABLE
+#    include "process_tap_dance.h"
+#endif // TAP_DANCE_ENABLE
+#ifdef RGB_MATRIX_ENABLE
+#    include "rgb_matrix.h"
+#endif // RGB_MATRIX_ENABLE
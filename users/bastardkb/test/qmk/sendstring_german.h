@@ -0,0 +1,40 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "keymap_german.h"
+
+/*
+ * `SEND_STRING` tables for a German host layout, as QMK's
+ * `keymap_extras/sendstring_german.h`: letters, digits, space, enter and basic
+ * punctuation.  Replaces the US tables of `../sim.c`.
+ */
+
+const uint8_t ascii_to_keycode_lut[128] = {
+    ['\n'] = KC_ENTER, [' '] = KC_SPACE, ['!'] = DE_1, ['-'] = DE_MINS, [','] = DE_COMM, ['.'] = DE_DOT, ['0'] = DE_0,
+    ['1'] = DE_1, ['2'] = DE_2, ['3'] = DE_3, ['4'] = DE_4, ['5'] = DE_5, ['6'] = DE_6, ['7'] = DE_7, ['8'] = DE_8, ['9'] = DE_9,
+    ['A'] = KC_A, ['B'] = KC_B, ['C'] = KC_C, ['D'] = KC_D, ['E'] = KC_E, ['F'] = KC_F, ['G'] = KC_G, ['H'] = KC_H, ['I'] = KC_I,
+    ['J'] = KC_J, ['K'] = KC_K, ['L'] = KC_L, ['M'] = KC_M, ['N'] = KC_N, ['O'] = KC_O, ['P'] = KC_P, ['Q'] = KC_Q, ['R'] = KC_R,
+    ['S'] = KC_S, ['T'] = KC_T, ['U'] = KC_U, ['V'] = KC_V, ['W'] = KC_W, ['X'] = KC_X, ['Y'] = DE_Y, ['Z'] = DE_Z,
+    ['a'] = KC_A, ['b'] = KC_B, ['c'] = KC_C, ['d'] = KC_D, ['e'] = KC_E, ['f'] = KC_F, ['g'] = KC_G, ['h'] = KC_H, ['i'] = KC_I,
+    ['j'] = KC_J, ['k'] = KC_K, ['l'] = KC_L, ['m'] = KC_M, ['n'] = KC_N, ['o'] = KC_O, ['p'] = KC_P, ['q'] = KC_Q, ['r'] = KC_R,
+    ['s'] = KC_S, ['t'] = KC_T, ['u'] = KC_U, ['v'] = KC_V, ['w'] = KC_W, ['x'] = KC_X, ['y'] = DE_Y, ['z'] = DE_Z,
+};
+/* '!' and 'A' to 'Z' */
+const uint8_t ascii_to_shift_lut[16] = {[4] = 0x02, [8] = 0xFE, [9] = 0xFF, [10] = 0xFF, [11] = 0x07};
+const uint8_t ascii_to_altgr_lut[16] = {0};
+const uint8_t ascii_to_dead_lut[16]  = {0};
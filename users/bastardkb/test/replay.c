@@ -0,0 +1,68 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdio.h>
+#include "sim.h"
+
+/*
+ * Replay a key event trace through a keymap, and print the reports sent, the
+ * text typed, the host time spent per event and the latency figures.
+ *
+ *     make replay TRACE=traces/handsdownneu.txt
+ */
+
+#include KEYMAP_C
+
+#define REPLAY_MAX_EVENTS 65536
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s <trace>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    static sim_event_t events[REPLAY_MAX_EVENTS];
+    size_t             count  = sim_load_events(argv[1], events, REPLAY_MAX_EVENTS);
+    sim_replay_stats_t replay = {0};
+
+    SIM_INIT(keymaps);
+    uint32_t start = sim_now();
+    latency_stats_reset();
+    sim_replay(events, count, &replay);
+    sim_tick(TAPPING_TERM);
+
+    for (size_t i = 0; i < sim_report_count; ++i) {
+        const sim_report_t *report = &sim_reports[i];
+        printf("%6lu ms  ", (unsigned long)(report->time - start));
+        switch (report->kind) {
+            case SIM_REPORT_KEYBOARD:
+                printf("keyboard mods %02X keys %02X %02X %02X %02X %02X %02X\n", report->mods, report->keys[0], report->keys[1], report->keys[2], report->keys[3], report->keys[4], report->keys[5]);
+                break;
+            case SIM_REPORT_EXTRA:
+                printf("extra    usage %04X\n", report->usage);
+                break;
+            case SIM_REPORT_MOUSE:
+                printf("mouse    buttons %02X\n", report->buttons);
+                break;
+        }
+    }
+    printf("typed: \"%s\"\n", sim_typed());
+    if (replay.events > 0) {
+        printf("host: %zu events, avg %llu ns, max %llu ns per event\n", replay.events, (unsigned long long)(replay.total_ns / replay.events), (unsigned long long)replay.max_ns);
+    }
+    latency_stats_print();
+    fputs(sim_console(), stdout);
+    return EXIT_SUCCESS;
+}
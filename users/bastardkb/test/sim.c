@@ -0,0 +1,954 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdarg.h>
+#include <stdio.h>
+#include <time.h>
+#include "sim.h"
+
+/* Userspace callbacks, from `bastardkb.c`. */
+void          keyboard_post_init_user(void);
+void          matrix_scan_user(void);
+void          housekeeping_task_user(void);
+bool          pre_process_record_user(uint16_t keycode, keyrecord_t *record);
+bool          process_record_user(uint16_t keycode, keyrecord_t *record);
+void          post_process_record_user(uint16_t keycode, keyrecord_t *record);
+layer_state_t layer_state_set_user(layer_state_t state);
+#ifdef POINTING_DEVICE_ENABLE
+report_mouse_t pointing_device_task_user(report_mouse_t mouse_report);
+#endif // POINTING_DEVICE_ENABLE
+
+#define IS_TAP_HOLD(keycode) (IS_QK_MOD_TAP(keycode) || IS_QK_LAYER_TAP(keycode))
+#define SIM_MAX_WAITING 8
+#define SIM_CONSOLE_SIZE 8192
+
+sim_report_t sim_reports[SIM_MAX_REPORTS];
+size_t       sim_report_count = 0;
+uint8_t      sim_raw_hid_report[RAW_EPSIZE];
+bool         debug_enable = false;
+
+bool (*sim_process_record_kb)(uint16_t keycode, keyrecord_t *record) = NULL;
+
+layer_state_t layer_state         = 0;
+layer_state_t default_layer_state = 1;
+
+static uint32_t sim_time = 0;
+static const uint16_t (*sim_keymaps)[MATRIX_ROWS][MATRIX_COLS];
+static uint8_t sim_layer_count = 0;
+/** \brief Layer each held key was pressed on, as QMK's source layer cache. */
+static uint8_t sim_source_layer[MATRIX_ROWS][MATRIX_COLS];
+
+static uint8_t           sim_mods      = 0;
+static uint8_t           sim_weak_mods = 0;
+static uint8_t           sim_keys[6];
+static uint8_t           sim_buttons = 0;
+static report_keyboard_t sim_last_report;
+
+static char   sim_console_buffer[SIM_CONSOLE_SIZE];
+static size_t sim_console_length = 0;
+
+/** \brief Undecided tap-hold key, and the events held back while it is. */
+static struct {
+    bool        pending;
+    keyrecord_t record;
+    uint16_t    keycode;
+} sim_tapping;
+static keyrecord_t sim_waiting[SIM_MAX_WAITING];
+static uint8_t     sim_waiting_count = 0;
+/** \brief Tap-hold keys resolved as a tap, whose release is a tap too. */
+static bool sim_tapped[MATRIX_ROWS][MATRIX_COLS];
+
+/* Host driver */
+
+static void sim_log_report(sim_report_t report) {
+    report.time = sim_time;
+    if (sim_report_count < SIM_MAX_REPORTS) {
+        sim_reports[sim_report_count++] = report;
+    }
+}
+
+static uint8_t sim_keyboard_leds(void) {
+    return 0;
+}
+
+static void sim_send_keyboard(report_keyboard_t *report) {
+    sim_report_t logged = {.kind = SIM_REPORT_KEYBOARD, .mods = report->mods};
+    memcpy(logged.keys, report->keys, sizeof(logged.keys));
+    sim_log_report(logged);
+}
+
+static void sim_send_nkro(report_nkro_t *report) {}
+
+static void sim_send_mouse(report_mouse_t *report) {
+    sim_log_report((sim_report_t){.kind = SIM_REPORT_MOUSE, .buttons = report->buttons, .x = report->x, .y = report->y, .v = report->v, .h = report->h});
+}
+
+static void sim_send_extra(report_extra_t *report) {
+    sim_log_report((sim_report_t){.kind = SIM_REPORT_EXTRA, .usage = report->usage});
+}
+
+static host_driver_t  sim_driver      = {sim_keyboard_leds, sim_send_keyboard, sim_send_nkro, sim_send_mouse, sim_send_extra};
+static host_driver_t *sim_host_driver = &sim_driver;
+
+host_driver_t *host_get_driver(void) {
+    return sim_host_driver;
+}
+
+void host_set_driver(host_driver_t *driver) {
+    sim_host_driver = driver;
+}
+
+/* Timer, console, raw HID */
+
+uint16_t timer_read(void) {
+    return (uint16_t)sim_time;
+}
+
+uint32_t timer_read32(void) {
+    return sim_time;
+}
+
+void wait_ms(uint16_t ms) {
+    // A busy wait: time passes, nothing else runs.
+    sim_time += ms;
+}
+
+int xprintf(const char *format, ...) {
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(sim_console_buffer + sim_console_length, SIM_CONSOLE_SIZE - sim_console_length, format, args);
+    va_end(args);
+    if (length > 0) {
+        sim_console_length += (size_t)length;
+        if (sim_console_length >= SIM_CONSOLE_SIZE) {
+            sim_console_length = SIM_CONSOLE_SIZE - 1;
+        }
+    }
+    return length;
+}
+
+const char *sim_console(void) {
+    return sim_console_buffer;
+}
+
+void raw_hid_send(uint8_t *data, uint8_t length) {
+    memcpy(sim_raw_hid_report, data, length < RAW_EPSIZE ? length : RAW_EPSIZE);
+}
+
+bool is_keyboard_master(void) {
+    return true;
+}
+
+bool is_keyboard_left(void) {
+    return true;
+}
+
+/* Split transactions */
+
+#ifdef SPLIT_KEYBOARD
+bool    sim_split_connected    = true;
+size_t  sim_split_transactions = 0;
+uint8_t sim_split_request[RPC_M2S_BUFFER_SIZE];
+uint8_t sim_split_request_size = 0;
+
+static slave_custom_transaction_handler_t sim_split_handlers[NUM_TRANSACTIONS];
+
+void transaction_register_rpc(int8_t transaction_id, slave_custom_transaction_handler_t handler) {
+    sim_split_handlers[transaction_id] = handler;
+}
+
+bool transaction_rpc_exec(int8_t transaction_id, uint8_t initiator2target_buflen, const void *initiator2target_buf, uint8_t target2initiator_buflen, void *target2initiator_buf) {
+    ++sim_split_transactions;
+    sim_split_request_size = initiator2target_buflen < RPC_M2S_BUFFER_SIZE ? initiator2target_buflen : RPC_M2S_BUFFER_SIZE;
+    memcpy(sim_split_request, initiator2target_buf, sim_split_request_size);
+    if (!sim_split_connected || sim_split_handlers[transaction_id] == NULL) {
+        return false;
+    }
+    sim_split_handlers[transaction_id](initiator2target_buflen, initiator2target_buf, target2initiator_buflen, target2initiator_buf);
+    return true;
+}
+#endif // SPLIT_KEYBOARD
+
+/* Keyboard report */
+
+void add_key(uint8_t key) {
+    for (uint8_t i = 0; i < sizeof(sim_keys); ++i) {
+        if (sim_keys[i] == key) {
+            return;
+        }
+    }
+    for (uint8_t i = 0; i < sizeof(sim_keys); ++i) {
+        if (sim_keys[i] == KC_NO) {
+            sim_keys[i] = key;
+            return;
+        }
+    }
+}
+
+void del_key(uint8_t key) {
+    for (uint8_t i = 0; i < sizeof(sim_keys); ++i) {
+        if (sim_keys[i] == key) {
+            sim_keys[i] = KC_NO;
+        }
+    }
+}
+
+void clear_keys(void) {
+    memset(sim_keys, 0, sizeof(sim_keys));
+}
+
+uint8_t get_mods(void) {
+    return sim_mods;
+}
+
+void add_mods(uint8_t mods) {
+    sim_mods |= mods;
+}
+
+void del_mods(uint8_t mods) {
+    sim_mods &= ~mods;
+}
+
+uint8_t get_weak_mods(void) {
+    return sim_weak_mods;
+}
+
+void add_weak_mods(uint8_t mods) {
+    sim_weak_mods |= mods;
+}
+
+void del_weak_mods(uint8_t mods) {
+    sim_weak_mods &= ~mods;
+}
+
+void clear_weak_mods(void) {
+    sim_weak_mods = 0;
+}
+
+void send_keyboard_report(void) {
+    report_keyboard_t report = {.mods = sim_mods | sim_weak_mods};
+    memcpy(report.keys, sim_keys, sizeof(report.keys));
+    // Like QMK, unchanged reports are not sent.
+    if (memcmp(&report, &sim_last_report, sizeof(report)) != 0) {
+        sim_last_report = report;
+        sim_host_driver->send_keyboard(&report);
+    }
+}
+
+static uint8_t sim_mods_to_8bit(uint8_t mods) {
+    return (mods & 0x10) ? (mods & 0x0F) << 4 : mods;
+}
+
+void register_code(uint8_t code) {
+    if (IS_MODIFIER_KEYCODE(code)) {
+        add_mods(MOD_BIT(code));
+        send_keyboard_report();
+    } else if (IS_BASIC_KEYCODE(code)) {
+        add_key(code);
+        send_keyboard_report();
+    } else if (IS_SYSTEM_KEYCODE(code) || IS_CONSUMER_KEYCODE(code)) {
+        sim_host_driver->send_extra(&(report_extra_t){.usage = code});
+    } else if (code >= KC_MS_BTN1 && code <= KC_MS_BTN3) {
+        sim_buttons |= 1 << (code - KC_MS_BTN1);
+        sim_host_driver->send_mouse(&(report_mouse_t){.buttons = sim_buttons});
+    }
+}
+
+void unregister_code(uint8_t code) {
+    if (IS_MODIFIER_KEYCODE(code)) {
+        del_mods(MOD_BIT(code));
+        send_keyboard_report();
+    } else if (IS_BASIC_KEYCODE(code)) {
+        del_key(code);
+        send_keyboard_report();
+    } else if (IS_SYSTEM_KEYCODE(code) || IS_CONSUMER_KEYCODE(code)) {
+        sim_host_driver->send_extra(&(report_extra_t){.usage = 0});
+    } else if (code >= KC_MS_BTN1 && code <= KC_MS_BTN3) {
+        sim_buttons &= ~(1 << (code - KC_MS_BTN1));
+        sim_host_driver->send_mouse(&(report_mouse_t){.buttons = sim_buttons});
+    }
+}
+
+void tap_code(uint8_t code) {
+    register_code(code);
+    wait_ms(TAP_CODE_DELAY);
+    unregister_code(code);
+}
+
+void register_code16(uint16_t code) {
+    uint8_t mods = IS_QK_MODS(code) ? sim_mods_to_8bit(QK_MODS_GET_MODS(code)) : 0;
+    if (mods != 0) {
+        add_weak_mods(mods);
+        send_keyboard_report();
+    }
+    register_code(code & 0xFF);
+}
+
+void unregister_code16(uint16_t code) {
+    unregister_code(code & 0xFF);
+    uint8_t mods = IS_QK_MODS(code) ? sim_mods_to_8bit(QK_MODS_GET_MODS(code)) : 0;
+    if (mods != 0) {
+        del_weak_mods(mods);
+        send_keyboard_report();
+    }
+}
+
+void tap_code16(uint16_t code) {
+    register_code16(code);
+    wait_ms(TAP_CODE_DELAY);
+    unregister_code16(code);
+}
+
+/* Layers and keymap */
+
+bool layer_state_cmp(layer_state_t state, uint8_t layer) {
+    if (state == 0) {
+        return layer == 0;
+    }
+    return (state & ((layer_state_t)1 << layer)) != 0;
+}
+
+bool layer_state_is(uint8_t layer) {
+    return layer_state_cmp(layer_state, layer);
+}
+
+uint8_t get_highest_layer(layer_state_t state) {
+    uint8_t layer = 0;
+    while (state >>= 1) {
+        ++layer;
+    }
+    return layer;
+}
+
+static void sim_layer_state_set(layer_state_t state) {
+    layer_state = layer_state_set_user(state);
+}
+
+void layer_on(uint8_t layer) {
+    sim_layer_state_set(layer_state | ((layer_state_t)1 << layer));
+}
+
+void layer_off(uint8_t layer) {
+    sim_layer_state_set(layer_state & ~((layer_state_t)1 << layer));
+}
+
+uint16_t keymap_key_to_keycode(uint8_t layer, keypos_t key) {
+#ifdef ENCODER_MAP_ENABLE
+    if ((key.row == KEYLOC_ENCODER_CW || key.row == KEYLOC_ENCODER_CCW) && key.col < NUM_ENCODERS) {
+        return layer < sim_layer_count ? encoder_map[layer][key.col][key.row == KEYLOC_ENCODER_CW ? 0 : 1] : KC_NO;
+    }
+#endif // ENCODER_MAP_ENABLE
+    if (layer >= sim_layer_count || key.row >= MATRIX_ROWS || key.col >= MATRIX_COLS) {
+        return KC_NO;
+    }
+#ifdef SPARSE_KEYMAP_ENABLE
+    return keycode_at_keymap_location(layer, key.row, key.col);
+#else
+    return sim_keymaps[layer][key.row][key.col];
+#endif // SPARSE_KEYMAP_ENABLE
+}
+
+uint8_t layer_switch_get_layer(keypos_t key) {
+    layer_state_t layers = layer_state | default_layer_state;
+    for (int8_t layer = MAX_LAYER - 1; layer >= 0; --layer) {
+        if ((layers & ((layer_state_t)1 << layer)) && keymap_key_to_keycode(layer, key) != KC_TRANSPARENT) {
+            return layer;
+        }
+    }
+    return get_highest_layer(default_layer_state);
+}
+
+static bool sim_is_matrix_key(keyevent_t event) {
+    return IS_KEYEVENT(event) && event.key.row < MATRIX_ROWS && event.key.col < MATRIX_COLS;
+}
+
+static uint16_t sim_record_keycode(keyrecord_t *record, bool update_layer_cache) {
+    keyevent_t event = record->event;
+    if (IS_ENCODEREVENT(event)) {
+        return keymap_key_to_keycode(layer_switch_get_layer(event.key), event.key);
+    }
+    if (!sim_is_matrix_key(event)) {
+        return KC_NO;
+    }
+    if (event.pressed && update_layer_cache) {
+        sim_source_layer[event.key.row][event.key.col] = layer_switch_get_layer(event.key);
+    }
+    return keymap_key_to_keycode(sim_source_layer[event.key.row][event.key.col], event.key);
+}
+
+/* Key event pipeline */
+
+__attribute__((weak)) uint16_t get_tapping_term(uint16_t keycode, keyrecord_t *record) {
+    return TAPPING_TERM;
+}
+
+__attribute__((weak)) bool get_hold_on_other_key_press(uint16_t keycode, keyrecord_t *record) {
+    return false;
+}
+
+#ifdef TAP_DANCE_ENABLE
+/* Tap dance, as QMK's `process_tap_dance.c` */
+
+static uint16_t sim_active_tap_dance = 0;
+static uint16_t sim_tap_dance_time   = 0;
+
+static tap_dance_action_t *sim_tap_dance_action(uint16_t keycode) {
+    return &tap_dance_actions[QK_TAP_DANCE_GET_INDEX(keycode)];
+}
+
+static void sim_tap_dance_finish(tap_dance_action_t *action) {
+    if (action->state.finished) {
+        return;
+    }
+    action->state.finished = true;
+    if (action->fn.on_dance_finished != NULL) {
+        action->fn.on_dance_finished(&action->state, action->user_data);
+    }
+}
+
+static void sim_tap_dance_reset(tap_dance_action_t *action) {
+    if (action->fn.on_reset != NULL) {
+        action->fn.on_reset(&action->state, action->user_data);
+    }
+    action->state        = (tap_dance_state_t){0};
+    sim_active_tap_dance = 0;
+}
+
+/** \brief A key pressed during a dance interrupts it. */
+static void sim_preprocess_tap_dance(uint16_t keycode, keyrecord_t *record) {
+    if (!record->event.pressed || sim_active_tap_dance == 0 || keycode == sim_active_tap_dance) {
+        return;
+    }
+    tap_dance_action_t *action         = sim_tap_dance_action(sim_active_tap_dance);
+    action->state.interrupted          = true;
+    action->state.interrupting_keycode = keycode;
+    sim_tap_dance_finish(action);
+    if (!action->state.pressed) {
+        sim_tap_dance_reset(action);
+    }
+}
+
+static void sim_process_tap_dance(uint16_t keycode, keyrecord_t *record) {
+    if (!IS_QK_TAP_DANCE(keycode)) {
+        return;
+    }
+    tap_dance_action_t *action = sim_tap_dance_action(keycode);
+    action->state.pressed      = record->event.pressed;
+    if (record->event.pressed) {
+        sim_tap_dance_time = record->event.time;
+        ++action->state.count;
+        if (action->fn.on_each_tap != NULL) {
+            action->fn.on_each_tap(&action->state, action->user_data);
+        }
+        sim_active_tap_dance = action->state.finished ? 0 : keycode;
+    } else {
+        if (action->fn.on_each_release != NULL) {
+            action->fn.on_each_release(&action->state, action->user_data);
+        }
+        if (action->state.finished) {
+            sim_tap_dance_reset(action);
+        }
+    }
+}
+
+static void sim_tap_dance_task(void) {
+    if (sim_active_tap_dance == 0) {
+        return;
+    }
+    tap_dance_action_t *action = sim_tap_dance_action(sim_active_tap_dance);
+    keyrecord_t         record = {0};
+    if (!action->state.interrupted && TIMER_DIFF_16(timer_read(), sim_tap_dance_time) > get_tapping_term(sim_active_tap_dance, &record)) {
+        sim_tap_dance_finish(action);
+        if (!action->state.pressed) {
+            sim_tap_dance_reset(action);
+        }
+    }
+}
+#endif // TAP_DANCE_ENABLE
+
+static void sim_process_action(uint16_t keycode, keyrecord_t *record) {
+    bool pressed = record->event.pressed;
+    if (IS_QK_MOMENTARY(keycode)) {
+        (pressed ? layer_on : layer_off)(QK_MOMENTARY_GET_LAYER(keycode));
+    } else if (IS_QK_LAYER_TAP(keycode)) {
+        if (record->tap.count > 0) {
+            (pressed ? register_code : unregister_code)(QK_LAYER_TAP_GET_TAP_KEYCODE(keycode));
+        } else {
+            (pressed ? layer_on : layer_off)(QK_LAYER_TAP_GET_LAYER(keycode));
+        }
+    } else if (IS_QK_MOD_TAP(keycode)) {
+        if (record->tap.count > 0) {
+            (pressed ? register_code : unregister_code)(QK_MOD_TAP_GET_TAP_KEYCODE(keycode));
+        } else {
+            (pressed ? add_mods : del_mods)(sim_mods_to_8bit(QK_MOD_TAP_GET_MODS(keycode)));
+            send_keyboard_report();
+        }
+    } else if (IS_QK_BASIC(keycode) || IS_QK_MODS(keycode)) {
+        (pressed ? register_code16 : unregister_code16)(keycode);
+    }
+}
+
+static void sim_process_record(keyrecord_t *record) {
+    uint16_t keycode = sim_record_keycode(record, false);
+    if (!record->event.pressed && sim_is_matrix_key(record->event) && sim_tapped[record->event.key.row][record->event.key.col]) {
+        sim_tapped[record->event.key.row][record->event.key.col] = false;
+        record->tap.count                                         = 1;
+    }
+#ifdef TAP_DANCE_ENABLE
+    sim_preprocess_tap_dance(keycode, record);
+#endif // TAP_DANCE_ENABLE
+    if (!process_record_user(keycode, record)) {
+        return;
+    }
+    if (sim_process_record_kb != NULL && !sim_process_record_kb(keycode, record)) {
+        return;
+    }
+#ifdef TAP_DANCE_ENABLE
+    sim_process_tap_dance(keycode, record);
+#endif // TAP_DANCE_ENABLE
+    sim_process_action(keycode, record);
+    post_process_record_user(keycode, record);
+}
+
+static void sim_tapping_process(keyrecord_t *record);
+
+static void sim_tapping_resolve(bool tap) {
+    keyrecord_t record  = sim_tapping.record;
+    sim_tapping.pending = false;
+    record.tap.count    = tap ? 1 : 0;
+    if (tap) {
+        sim_tapped[record.event.key.row][record.event.key.col] = true;
+    }
+    sim_process_record(&record);
+
+    keyrecord_t waiting[SIM_MAX_WAITING];
+    uint8_t     count = sim_waiting_count;
+    memcpy(waiting, sim_waiting, sizeof(waiting));
+    sim_waiting_count = 0;
+    for (uint8_t i = 0; i < count; ++i) {
+        sim_tapping_process(&waiting[i]);
+    }
+}
+
+static void sim_tapping_process(keyrecord_t *record) {
+    if (sim_tapping.pending) {
+        if (!record->event.pressed && KEYEQ(record->event.key, sim_tapping.record.event.key)) {
+            sim_tapping_resolve(true);
+            sim_process_record(record);
+            return;
+        }
+        if (record->event.pressed) {
+            sim_tapping.record.tap.interrupted = true;
+            if (get_hold_on_other_key_press(sim_tapping.keycode, &sim_tapping.record)) {
+                sim_tapping_resolve(false);
+                sim_tapping_process(record);
+                return;
+            }
+        }
+        if (sim_waiting_count == SIM_MAX_WAITING) {
+            sim_tapping_resolve(false);
+            sim_tapping_process(record);
+            return;
+        }
+        sim_waiting[sim_waiting_count++] = *record;
+        return;
+    }
+    uint16_t keycode = sim_record_keycode(record, false);
+    if (record->event.pressed && sim_is_matrix_key(record->event) && IS_TAP_HOLD(keycode)) {
+        sim_tapping.pending = true;
+        sim_tapping.record  = *record;
+        sim_tapping.keycode = keycode;
+        return;
+    }
+    sim_process_record(record);
+}
+
+void action_exec(keyevent_t event) {
+    keyrecord_t record = {.event = event};
+    if (!pre_process_record_user(sim_record_keycode(&record, true), &record)) {
+        return;
+    }
+    sim_tapping_process(&record);
+}
+
+/* RGB matrix */
+
+#ifdef RGB_MATRIX_ENABLE
+RGB    sim_rgb_leds[RGB_MATRIX_LED_COUNT];
+size_t sim_rgb_writes  = 0;
+size_t sim_rgb_flushes = 0;
+
+static bool     sim_rgb_enabled = true;
+static uint8_t  sim_rgb_mode    = RGB_MATRIX_DEFAULT_MODE;
+static HSV      sim_rgb_hsv     = {HSV_RED};
+static bool     sim_rgb_clear   = false;
+static uint32_t sim_rgb_clear_time;
+
+RGB hsv_to_rgb(HSV hsv) {
+    if (hsv.s == 0) {
+        return (RGB){hsv.v, hsv.v, hsv.v};
+    }
+    uint8_t region    = hsv.h / 43;
+    uint8_t remainder = (hsv.h - region * 43) * 6;
+    uint8_t p         = (hsv.v * (255 - hsv.s)) >> 8;
+    uint8_t q         = (hsv.v * (255 - ((hsv.s * remainder) >> 8))) >> 8;
+    uint8_t t         = (hsv.v * (255 - ((hsv.s * (255 - remainder)) >> 8))) >> 8;
+    switch (region) {
+        case 0:
+            return (RGB){hsv.v, t, p};
+        case 1:
+            return (RGB){q, hsv.v, p};
+        case 2:
+            return (RGB){p, hsv.v, t};
+        case 3:
+            return (RGB){p, q, hsv.v};
+        case 4:
+            return (RGB){t, p, hsv.v};
+        default:
+            return (RGB){hsv.v, p, q};
+    }
+}
+
+void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+    if (index >= 0 && index < RGB_MATRIX_LED_COUNT) {
+        sim_rgb_leds[index] = (RGB){red, green, blue};
+        ++sim_rgb_writes;
+    }
+}
+
+void rgb_matrix_update_pwm_buffers(void) {
+    ++sim_rgb_flushes;
+}
+
+bool rgb_matrix_is_enabled(void) {
+    return sim_rgb_enabled;
+}
+
+void rgb_matrix_enable_noeeprom(void) {
+    sim_rgb_enabled = true;
+}
+
+void rgb_matrix_disable_noeeprom(void) {
+    sim_rgb_enabled = false;
+    memset(sim_rgb_leds, 0, sizeof(sim_rgb_leds));
+}
+
+uint8_t rgb_matrix_get_mode(void) {
+    return sim_rgb_mode;
+}
+
+void rgb_matrix_mode_noeeprom(uint8_t mode) {
+    sim_rgb_mode = mode;
+    if (mode == RGB_MATRIX_NONE) {
+        sim_rgb_clear      = true;
+        sim_rgb_clear_time = sim_time + RGB_MATRIX_LED_FLUSH_LIMIT;
+    }
+}
+
+uint8_t rgb_matrix_get_val(void) {
+    return sim_rgb_hsv.v;
+}
+
+void rgb_matrix_sethsv_noeeprom(uint8_t hue, uint8_t sat, uint8_t val) {
+    sim_rgb_hsv = (HSV){hue, sat, val};
+}
+
+/** \brief The render cycle of the `RGB_MATRIX_NONE` effect, which clears the LEDs once. */
+static void sim_rgb_matrix_task(void) {
+    if (sim_rgb_clear && sim_rgb_mode == RGB_MATRIX_NONE && sim_time >= sim_rgb_clear_time) {
+        sim_rgb_clear = false;
+        memset(sim_rgb_leds, 0, sizeof(sim_rgb_leds));
+    }
+}
+
+static void sim_rgb_matrix_init(void) {
+    sim_rgb_enabled = true;
+    sim_rgb_mode    = RGB_MATRIX_DEFAULT_MODE;
+    sim_rgb_hsv     = (HSV){HSV_RED};
+    sim_rgb_clear   = false;
+    sim_rgb_writes  = 0;
+    sim_rgb_flushes = 0;
+    memset(sim_rgb_leds, 0, sizeof(sim_rgb_leds));
+}
+#endif // RGB_MATRIX_ENABLE
+
+/* Pointing device */
+
+#ifdef POINTING_DEVICE_ENABLE
+/** \brief Sensor motion not read yet. */
+static int16_t sim_pointer_x = 0;
+static int16_t sim_pointer_y = 0;
+
+void sim_pointer_move(int16_t x, int16_t y) {
+    sim_pointer_x += x;
+    sim_pointer_y += y;
+}
+
+/** \brief Take as much of `pending` as fits in a report. */
+static mouse_xy_report_t sim_pointer_take(int16_t *pending) {
+    int16_t value = *pending < -INT8_MAX ? -INT8_MAX : *pending > INT8_MAX ? INT8_MAX : *pending;
+    *pending -= value;
+    return value;
+}
+
+/** \brief As QMK's `pointing_device_task`: mouse keys send their own reports. */
+static void sim_pointing_device_task(void) {
+    report_mouse_t report = {.buttons = sim_buttons, .x = sim_pointer_take(&sim_pointer_x), .y = sim_pointer_take(&sim_pointer_y)};
+    report                = pointing_device_task_user(report);
+    if (report.x != 0 || report.y != 0 || report.v != 0 || report.h != 0 || report.buttons != sim_buttons) {
+        sim_buttons = report.buttons;
+        sim_host_driver->send_mouse(&report);
+    }
+}
+#endif // POINTING_DEVICE_ENABLE
+
+/* Scan loop */
+
+static void sim_housekeeping(void) {
+    housekeeping_task_user();
+}
+
+static void sim_scan(void) {
+    matrix_scan_user();
+    if (sim_tapping.pending && TIMER_DIFF_16(timer_read(), sim_tapping.record.event.time) >= get_tapping_term(sim_tapping.keycode, &sim_tapping.record)) {
+        sim_tapping_resolve(false);
+    }
+#ifdef TAP_DANCE_ENABLE
+    sim_tap_dance_task();
+#endif // TAP_DANCE_ENABLE
+#ifdef RGB_MATRIX_ENABLE
+    sim_rgb_matrix_task();
+#endif // RGB_MATRIX_ENABLE
+#ifdef POINTING_DEVICE_ENABLE
+    sim_pointing_device_task();
+#endif // POINTING_DEVICE_ENABLE
+    sim_housekeeping();
+}
+
+void sim_init(const uint16_t (*keymaps)[MATRIX_ROWS][MATRIX_COLS], uint8_t layer_count) {
+    // Leave a gap after the previous test, so its keys are long forgotten.
+    sim_time += 10000;
+    sim_keymaps         = keymaps;
+    sim_layer_count     = keymaps != NULL ? layer_count : 0;
+    layer_state         = 0;
+    default_layer_state = 1;
+    sim_mods            = 0;
+    sim_weak_mods       = 0;
+    sim_buttons         = 0;
+    sim_tapping.pending = false;
+    sim_waiting_count   = 0;
+    clear_keys();
+    memset(&sim_last_report, 0, sizeof(sim_last_report));
+    memset(sim_tapped, 0, sizeof(sim_tapped));
+    memset(sim_source_layer, 0, sizeof(sim_source_layer));
+    sim_process_record_kb = NULL;
+    sim_host_driver       = &sim_driver;
+    sim_console_length    = 0;
+    sim_console_buffer[0] = '\0';
+    debug_enable          = false;
+#ifdef SPLIT_KEYBOARD
+    sim_split_connected    = true;
+    sim_split_transactions = 0;
+    sim_split_request_size = 0;
+#endif // SPLIT_KEYBOARD
+    sim_clear_reports();
+#ifdef RGB_MATRIX_ENABLE
+    sim_rgb_matrix_init();
+#endif // RGB_MATRIX_ENABLE
+#ifdef POINTING_DEVICE_ENABLE
+    sim_pointer_x = 0;
+    sim_pointer_y = 0;
+#endif // POINTING_DEVICE_ENABLE
+    keyboard_post_init_user();
+}
+
+uint32_t sim_now(void) {
+    return sim_time;
+}
+
+void sim_tick(uint32_t ms) {
+    while (ms-- > 0) {
+        ++sim_time;
+        sim_scan();
+    }
+}
+
+static void sim_event(uint8_t row, uint8_t col, bool pressed) {
+    action_exec((keyevent_t){.key = {.row = row, .col = col}, .time = timer_read(), .type = KEY_EVENT, .pressed = pressed});
+    sim_housekeeping();
+}
+
+void sim_press(uint8_t row, uint8_t col) {
+    sim_event(row, col, true);
+}
+
+void sim_release(uint8_t row, uint8_t col) {
+    sim_event(row, col, false);
+}
+
+void sim_tap(uint8_t row, uint8_t col, uint32_t ms) {
+    sim_press(row, col);
+    sim_tick(ms);
+    sim_release(row, col);
+}
+
+#ifdef ENCODER_MAP_ENABLE
+void sim_encoder(uint8_t index, bool clockwise) {
+    keypos_t        key  = {.row = clockwise ? KEYLOC_ENCODER_CW : KEYLOC_ENCODER_CCW, .col = index};
+    keyevent_type_t type = clockwise ? ENCODER_CW_EVENT : ENCODER_CCW_EVENT;
+    action_exec((keyevent_t){.key = key, .time = timer_read(), .type = type, .pressed = true});
+    action_exec((keyevent_t){.key = key, .time = timer_read(), .type = type, .pressed = false});
+    sim_housekeeping();
+}
+#endif // ENCODER_MAP_ENABLE
+
+keypos_t sim_key(uint16_t keycode) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; ++row) {
+        for (uint8_t col = 0; col < MATRIX_COLS; ++col) {
+            keypos_t key = {.row = row, .col = col};
+            if (keymap_key_to_keycode(0, key) == keycode) {
+                return key;
+            }
+        }
+    }
+    fprintf(stderr, "sim: keycode 0x%04X is not on the base layer\n", keycode);
+    exit(EXIT_FAILURE);
+}
+
+void sim_tap_keycode(uint16_t keycode, uint32_t ms) {
+    keypos_t key = sim_key(keycode);
+    sim_tap(key.row, key.col, ms);
+}
+
+size_t sim_load_events(const char *path, sim_event_t *events, size_t max) {
+    FILE *file = fopen(path, "r");
+    if (file == NULL) {
+        perror(path);
+        exit(EXIT_FAILURE);
+    }
+    char     line[128];
+    size_t   count       = 0;
+    unsigned line_number = 0;
+    while (fgets(line, sizeof(line), file) != NULL) {
+        ++line_number;
+        unsigned long time;
+        unsigned      row, col, pressed;
+        if (line[0] == '#' || strspn(line, " \t\r\n") == strlen(line)) {
+            continue;
+        }
+        if (sscanf(line, "%lu %u %u %u", &time, &row, &col, &pressed) != 4 || row >= MATRIX_ROWS || col >= MATRIX_COLS || count == max) {
+            fprintf(stderr, "%s:%u: invalid event, expected `<ms> <row> <col> <pressed>`\n", path, line_number);
+            exit(EXIT_FAILURE);
+        }
+        events[count++] = (sim_event_t){.time = time, .row = row, .col = col, .pressed = pressed != 0};
+    }
+    fclose(file);
+    return count;
+}
+
+void sim_replay(const sim_event_t *events, size_t count, sim_replay_stats_t *stats) {
+    uint32_t start = sim_time;
+    for (size_t i = 0; i < count; ++i) {
+        if (start + events[i].time > sim_time) {
+            sim_tick(start + events[i].time - sim_time);
+        }
+        uint64_t begin = sim_clock_ns();
+        sim_event(events[i].row, events[i].col, events[i].pressed);
+        uint64_t elapsed = sim_clock_ns() - begin;
+        if (stats != NULL) {
+            ++stats->events;
+            stats->total_ns += elapsed;
+            if (elapsed > stats->max_ns) {
+                stats->max_ns = elapsed;
+            }
+        }
+    }
+}
+
+/* Report log */
+
+void sim_clear_reports(void) {
+    sim_report_count = 0;
+}
+
+size_t sim_count_reports(sim_report_kind_t kind) {
+    size_t count = 0;
+    for (size_t i = 0; i < sim_report_count; ++i) {
+        count += sim_reports[i].kind == kind;
+    }
+    return count;
+}
+
+static char sim_keycode_char(uint8_t keycode, bool shifted) {
+    if (keycode >= KC_A && keycode <= KC_Z) {
+        return (shifted ? 'A' : 'a') + keycode - KC_A;
+    }
+    if (keycode >= KC_1 && keycode <= KC_9) {
+        return '1' + keycode - KC_1;
+    }
+    static const char punctuation[] = "\n??\t -=[]\\#;'`,./";
+    if (keycode == KC_0) {
+        return '0';
+    }
+    if (keycode >= KC_ENTER && keycode <= KC_SLASH) {
+        return punctuation[keycode - KC_ENTER];
+    }
+    return '?';
+}
+
+const char *sim_typed(void) {
+    static char typed[SIM_MAX_REPORTS * 6 + 1];
+    size_t      length  = 0;
+    uint8_t     held[6] = {0};
+    for (size_t i = 0; i < sim_report_count; ++i) {
+        const sim_report_t *report = &sim_reports[i];
+        if (report->kind != SIM_REPORT_KEYBOARD) {
+            continue;
+        }
+        for (uint8_t j = 0; j < 6; ++j) {
+            uint8_t key = report->keys[j];
+            if (key != KC_NO && memchr(held, key, sizeof(held)) == NULL) {
+                typed[length++] = sim_keycode_char(key, report->mods & MOD_MASK_SHIFT);
+            }
+        }
+        memcpy(held, report->keys, sizeof(held));
+    }
+    typed[length] = '\0';
+    return typed;
+}
+
+uint64_t sim_clock_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+/* US ANSI host layout, as QMK's `send_string_keycodes.h`.  Weak, replaced by `sendstring_*.h`. */
+
+__attribute__((weak)) const uint8_t ascii_to_keycode_lut[128] = {
+    ['\n'] = KC_ENTER, [' '] = KC_SPACE, ['!'] = KC_1, ['-'] = KC_MINUS, [','] = KC_COMMA, ['.'] = KC_DOT, ['0'] = KC_0,
+    ['1'] = KC_1, ['2'] = KC_2, ['3'] = KC_3, ['4'] = KC_4, ['5'] = KC_5, ['6'] = KC_6, ['7'] = KC_7, ['8'] = KC_8, ['9'] = KC_9,
+    ['A'] = KC_A, ['B'] = KC_B, ['C'] = KC_C, ['D'] = KC_D, ['E'] = KC_E, ['F'] = KC_F, ['G'] = KC_G, ['H'] = KC_H, ['I'] = KC_I,
+    ['J'] = KC_J, ['K'] = KC_K, ['L'] = KC_L, ['M'] = KC_M, ['N'] = KC_N, ['O'] = KC_O, ['P'] = KC_P, ['Q'] = KC_Q, ['R'] = KC_R,
+    ['S'] = KC_S, ['T'] = KC_T, ['U'] = KC_U, ['V'] = KC_V, ['W'] = KC_W, ['X'] = KC_X, ['Y'] = KC_Y, ['Z'] = KC_Z,
+    ['a'] = KC_A, ['b'] = KC_B, ['c'] = KC_C, ['d'] = KC_D, ['e'] = KC_E, ['f'] = KC_F, ['g'] = KC_G, ['h'] = KC_H, ['i'] = KC_I,
+    ['j'] = KC_J, ['k'] = KC_K, ['l'] = KC_L, ['m'] = KC_M, ['n'] = KC_N, ['o'] = KC_O, ['p'] = KC_P, ['q'] = KC_Q, ['r'] = KC_R,
+    ['s'] = KC_S, ['t'] = KC_T, ['u'] = KC_U, ['v'] = KC_V, ['w'] = KC_W, ['x'] = KC_X, ['y'] = KC_Y, ['z'] = KC_Z,
+};
+/* '!' and 'A' to 'Z' */
+__attribute__((weak)) const uint8_t ascii_to_shift_lut[16] = {[4] = 0x02, [8] = 0xFE, [9] = 0xFF, [10] = 0xFF, [11] = 0x07};
+__attribute__((weak)) const uint8_t ascii_to_altgr_lut[16] = {0};
+__attribute__((weak)) const uint8_t ascii_to_dead_lut[16]  = {0};
@@ -0,0 +1,187 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "quantum.h"
+
+/*
+ * Simulated keyboard, to run the userspace on the host.
+ *
+ * Stands in for the parts of QMK the userspace runs on: a virtual millisecond
+ * clock, the key event pipeline (`pre_process_record_user`, a simplified
+ * tap-hold resolver, `process_record_user`, tap dance, basic keycode, modifier
+ * and layer actions, `post_process_record_user`), the keyboard report and a
+ * host driver logging every report sent.  The userspace callbacks are those of
+ * `bastardkb.c`, the keymap is given to `sim_init`.
+ *
+ * The tap-hold resolver only implements the tapping term and
+ * `get_hold_on_other_key_press`: a tap-hold key released before its tapping
+ * term is a tap, one still held when the term expires or when
+ * `get_hold_on_other_key_press` returns true for another key press is a hold.
+ * Keys pressed while it is undecided are held back until it is.
+ *
+ * With `ENCODER_MAP_ENABLE`, encoder detents are resolved through the keymap's
+ * `encoder_map`.  With `POINTING_DEVICE_ENABLE`, each scan reads the sensor
+ * motion given to `sim_pointer_move`, runs `pointing_device_task_user` and
+ * sends the mouse report if it moves, scrolls or changes the buttons.
+ */
+
+/** \brief Scan events given to `sim_replay`. */
+typedef struct {
+    uint32_t time; // Milliseconds since the start of the replay.
+    uint8_t  row;
+    uint8_t  col;
+    bool     pressed;
+} sim_event_t;
+
+typedef enum {
+    SIM_REPORT_KEYBOARD,
+    SIM_REPORT_EXTRA,
+    SIM_REPORT_MOUSE,
+} sim_report_kind_t;
+
+/** \brief Report handed to the host driver. */
+typedef struct {
+    uint32_t          time;
+    sim_report_kind_t kind;
+    uint8_t           mods;    // Keyboard reports.
+    uint8_t           keys[6]; // Keyboard reports.
+    uint16_t          usage;   // Extra reports: the consumer or system keycode, 0 on release.
+    uint8_t           buttons; // Mouse reports.
+    int16_t           x;       // Mouse reports.
+    int16_t           y;       // Mouse reports.
+    int16_t           v;       // Mouse reports.
+    int16_t           h;       // Mouse reports.
+} sim_report_t;
+
+#define SIM_MAX_REPORTS 8192
+
+extern sim_report_t sim_reports[SIM_MAX_REPORTS];
+extern size_t       sim_report_count;
+
+/**
+ * \brief Keyboard level `process_record_kb` handler, run after `process_record_user`.
+ *
+ * Returning false skips the action and `post_process_record_user`, as QMK does.
+ */
+extern bool (*sim_process_record_kb)(uint16_t keycode, keyrecord_t *record);
+
+/** \brief Reset the keyboard, then run `keyboard_post_init_user`.  `keymaps` may be NULL. */
+void sim_init(const uint16_t (*keymaps)[MATRIX_ROWS][MATRIX_COLS], uint8_t layer_count);
+#define SIM_INIT(keymaps) sim_init(keymaps, ARRAY_SIZE(keymaps))
+
+/** \brief Current time of the virtual clock, in milliseconds. */
+uint32_t sim_now(void);
+
+/** \brief Run `ms` scan loop iterations, one per millisecond. */
+void sim_tick(uint32_t ms);
+
+/** \brief Press or release a key, in the current scan loop iteration. */
+void sim_press(uint8_t row, uint8_t col);
+void sim_release(uint8_t row, uint8_t col);
+
+/** \brief Press a key, wait `ms` and release it. */
+void sim_tap(uint8_t row, uint8_t col, uint32_t ms);
+
+#ifdef ENCODER_MAP_ENABLE
+/** \brief Turn encoder `index` by one detent: a press and a release on its `encoder_map` keycode, as QMK does. */
+void sim_encoder(uint8_t index, bool clockwise);
+#endif // ENCODER_MAP_ENABLE
+
+#ifdef POINTING_DEVICE_ENABLE
+/** \brief Move the sensor.  Each scan reads as much of the motion not read yet as a report holds. */
+void sim_pointer_move(int16_t x, int16_t y);
+#endif // POINTING_DEVICE_ENABLE
+
+/** \brief Return the position of `keycode` on the base layer, exits if it isn't there. */
+keypos_t sim_key(uint16_t keycode);
+
+/** \brief Tap the key of `keycode` on the base layer for `ms`. */
+void sim_tap_keycode(uint16_t keycode, uint32_t ms);
+
+/**
+ * \brief Read up to `max` events from a text file, exits on error.
+ *
+ * One event per line: `<ms> <row> <col> <pressed>`, the time in milliseconds
+ * since the start of the trace and `pressed` 1 or 0.  The rest of the line and
+ * lines starting with `#` are comments.
+ */
+size_t sim_load_events(const char *path, sim_event_t *events, size_t max);
+
+/** \brief Host time spent processing replayed events, each with its scan's housekeeping. */
+typedef struct {
+    size_t   events;
+    uint64_t total_ns;
+    uint64_t max_ns;
+} sim_replay_stats_t;
+
+/** \brief Feed `count` events at their time relative to now.  `stats` may be NULL. */
+void sim_replay(const sim_event_t *events, size_t count, sim_replay_stats_t *stats);
+
+/** \brief Forget the reports sent so far. */
+void sim_clear_reports(void);
+
+/** \brief Number of reports of `kind` sent. */
+size_t sim_count_reports(sim_report_kind_t kind);
+
+/**
+ * \brief Text typed by the keyboard reports sent, ie. each newly pressed key.
+ *
+ * Keys are shown as on a US layout, letters in upper case when shift is held.
+ * Keys without a character are shown as `?`.
+ */
+const char *sim_typed(void);
+
+/** \brief Console output (`uprintf`) since the last `sim_init`. */
+const char *sim_console(void);
+
+/** \brief Last raw HID report sent. */
+extern uint8_t sim_raw_hid_report[RAW_EPSIZE];
+
+#ifdef SPLIT_KEYBOARD
+/**
+ * \brief Split link.
+ *
+ * The simulated keyboard is the primary half, and runs the secondary half's
+ * transaction handlers itself, on the same variables.  While
+ * `sim_split_connected` is false, every transaction fails.
+ */
+extern bool    sim_split_connected;
+extern size_t  sim_split_transactions; // Transactions attempted since `sim_init`.
+extern uint8_t sim_split_request[RPC_M2S_BUFFER_SIZE];
+extern uint8_t sim_split_request_size; // Size of the last transaction's request.
+#endif // SPLIT_KEYBOARD
+
+/** \brief Monotonic host clock, for benchmarks. */
+uint64_t sim_clock_ns(void);
+
+#ifdef RGB_MATRIX_ENABLE
+/**
+ * \brief RGB matrix LEDs, as set by `rgb_matrix_set_color`.
+ *
+ * Like QMK's render cycle, switching the effect to `RGB_MATRIX_NONE` turns
+ * them all off `RGB_MATRIX_LED_FLUSH_LIMIT` ms later.
+ */
+extern RGB sim_rgb_leds[RGB_MATRIX_LED_COUNT];
+
+/** \brief Calls to `rgb_matrix_set_color` and `rgb_matrix_update_pwm_buffers` since `sim_init`. */
+extern size_t sim_rgb_writes;
+extern size_t sim_rgb_flushes;
+#endif // RGB_MATRIX_ENABLE
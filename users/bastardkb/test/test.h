@@ -0,0 +1,67 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <stdio.h>
+#include <string.h>
+
+/*
+ * Minimal test runner.  A failed check prints its location and makes
+ * `TEST_EXIT` return a non-zero status, the remaining checks still run.
+ */
+
+static int test_failures = 0;
+
+#define CHECK(condition)                                                                  \
+    do {                                                                                  \
+        if (!(condition)) {                                                               \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            ++test_failures;                                                              \
+        }                                                                                 \
+    } while (0)
+
+#define CHECK_EQ(actual, expected)                                                                                  \
+    do {                                                                                                            \
+        long long actual_ = (actual), expected_ = (expected);                                                       \
+        if (actual_ != expected_) {                                                                                 \
+            fprintf(stderr, "%s:%d: %s is %lld, expected %lld\n", __FILE__, __LINE__, #actual, actual_, expected_); \
+            ++test_failures;                                                                                        \
+        }                                                                                                           \
+    } while (0)
+
+#define CHECK_STR(actual, expected)                                                                                     \
+    do {                                                                                                                \
+        const char *actual_ = (actual), *expected_ = (expected);                                                        \
+        if (strcmp(actual_, expected_) != 0) {                                                                          \
+            fprintf(stderr, "%s:%d: %s is \"%s\", expected \"%s\"\n", __FILE__, __LINE__, #actual, actual_, expected_); \
+            ++test_failures;                                                                                            \
+        }                                                                                                               \
+    } while (0)
+
+#define RUN_TEST(test)           \
+    do {                         \
+        printf("  %s\n", #test); \
+        test();                  \
+    } while (0)
+
+#define TEST_EXIT()                                                               \
+    do {                                                                          \
+        if (test_failures > 0) {                                                  \
+            fprintf(stderr, "%s: %d check(s) failed\n", __FILE__, test_failures); \
+        }                                                                         \
+        return test_failures > 0;                                                 \
+    } while (0)
@@ -0,0 +1,101 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "bastardkb.h"
+#include "sim.h"
+#include "test.h"
+
+/*
+ * Burst macros: the reports sent for strings and keycode sequences.  With a
+ * 1 ms polling interval, each report takes a USB frame.
+ */
+
+static bool report_is(size_t index, sim_report_kind_t kind, uint8_t mods, uint8_t key0, uint8_t key1) {
+    const sim_report_t *report = &sim_reports[index];
+    return report->kind == kind && report->mods == mods && report->keys[0] == key0 && report->keys[1] == key1;
+}
+
+static void test_string(void) {
+    sim_init(NULL, 0);
+    send_burst_string("qu");
+    CHECK_STR(sim_typed(), "qu");
+    // 2 frames instead of 4 with `SEND_STRING`.
+    CHECK_EQ(sim_report_count, 2);
+    CHECK(report_is(0, SIM_REPORT_KEYBOARD, 0, KC_Q, KC_U));
+    CHECK(report_is(1, SIM_REPORT_KEYBOARD, 0, KC_NO, KC_NO));
+}
+
+static void test_string_modifiers(void) {
+    sim_init(NULL, 0);
+    send_burst_string("Hey");
+    CHECK_STR(sim_typed(), "Hey");
+    // 5 frames instead of 8 with `SEND_STRING`: the release of `H` is merged
+    // into the release of shift.
+    CHECK_EQ(sim_report_count, 5);
+    CHECK(report_is(0, SIM_REPORT_KEYBOARD, MOD_BIT(KC_LSFT), KC_NO, KC_NO));
+    CHECK(report_is(1, SIM_REPORT_KEYBOARD, MOD_BIT(KC_LSFT), KC_H, KC_NO));
+    CHECK(report_is(2, SIM_REPORT_KEYBOARD, 0, KC_NO, KC_NO));
+    CHECK(report_is(3, SIM_REPORT_KEYBOARD, 0, KC_E, KC_Y));
+    CHECK(report_is(4, SIM_REPORT_KEYBOARD, 0, KC_NO, KC_NO));
+}
+
+static void test_string_repeated_key(void) {
+    sim_init(NULL, 0);
+    // The second `l` needs a release first, and `e` can't follow `l` in a
+    // report: one press and one release each, as with `SEND_STRING`.
+    send_burst_string("lle");
+    CHECK_STR(sim_typed(), "lle");
+    CHECK_EQ(sim_report_count, 6);
+}
+
+static void test_keycodes_modified(void) {
+    sim_init(NULL, 0);
+    SEND_BURST(KC_A, LSFT(KC_B), LSFT(KC_C));
+    CHECK_STR(sim_typed(), "aBC");
+    CHECK_EQ(sim_report_count, 4);
+    CHECK(report_is(0, SIM_REPORT_KEYBOARD, 0, KC_A, KC_NO));
+    CHECK(report_is(1, SIM_REPORT_KEYBOARD, MOD_BIT(KC_LSFT), KC_NO, KC_NO));
+    CHECK(report_is(2, SIM_REPORT_KEYBOARD, MOD_BIT(KC_LSFT), KC_B, KC_C));
+    CHECK(report_is(3, SIM_REPORT_KEYBOARD, 0, KC_NO, KC_NO));
+}
+
+static void test_keycodes_consumer(void) {
+    sim_init(NULL, 0);
+    SEND_BURST(KC_A, KC_VOLU, KC_B, KC_BTN1);
+    CHECK_STR(sim_typed(), "ab");
+    CHECK_EQ(sim_report_count, 8);
+    CHECK(report_is(0, SIM_REPORT_KEYBOARD, 0, KC_A, KC_NO));
+    CHECK(report_is(1, SIM_REPORT_KEYBOARD, 0, KC_NO, KC_NO));
+    CHECK(sim_reports[2].kind == SIM_REPORT_EXTRA && sim_reports[2].usage == KC_VOLU);
+    CHECK(sim_reports[3].kind == SIM_REPORT_EXTRA && sim_reports[3].usage == 0);
+    CHECK(report_is(4, SIM_REPORT_KEYBOARD, 0, KC_B, KC_NO));
+    CHECK(report_is(5, SIM_REPORT_KEYBOARD, 0, KC_NO, KC_NO));
+    CHECK(sim_reports[6].kind == SIM_REPORT_MOUSE && sim_reports[6].buttons == 1);
+    CHECK(sim_reports[7].kind == SIM_REPORT_MOUSE && sim_reports[7].buttons == 0);
+    for (size_t i = 0; i < sim_report_count; ++i) {
+        // Only keyboard usages in the keyboard report.
+        CHECK(sim_reports[i].kind != SIM_REPORT_KEYBOARD || sim_reports[i].keys[0] <= KC_EXSEL);
+    }
+}
+
+int main(void) {
+    RUN_TEST(test_string);
+    RUN_TEST(test_string_modifiers);
+    RUN_TEST(test_string_repeated_key);
+    RUN_TEST(test_keycodes_modified);
+    RUN_TEST(test_keycodes_consumer);
+    TEST_EXIT();
+}
@@ -0,0 +1,151 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "bastardkb.h"
+#include "sim.h"
+#include "test.h"
+
+/*
+ * High-resolution drag-scroll: the keycodes, counts short of a wheel step
+ * carried over, the axis lock and its release, and the report interval.  Built
+ * with an 8 ms interval, see the Makefile, so that it spans several scans.
+ */
+
+// clang-format off
+static const uint16_t keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
+    {
+        {KC_Q,    KC_W,    KC_E,    KC_R,    KC_T},
+        {KC_A,    KC_S,    KC_D,    KC_F,    KC_G},
+        {KC_Z,    KC_X,    KC_C,    KC_V,    KC_B},
+        {KC_NO,   KC_NO,   DRGSCRL, DRG_TOG, KC_BTN1},
+        {KC_Y,    KC_U,    KC_I,    KC_O,    KC_P},
+        {KC_H,    KC_J,    KC_K,    KC_L,    KC_QUOTE},
+        {KC_N,    KC_M,    KC_COMM, KC_DOT,  KC_SLSH},
+        {KC_NO,   KC_NO,   KC_ENT,  KC_BSPC, KC_GRAVE},
+    },
+};
+// clang-format on
+
+static void setup(void) {
+    SIM_INIT(keymaps);
+    drag_scroll_set_enabled(false);
+}
+
+/** \brief Sums of the mouse reports sent so far. */
+static report_mouse_t sent(void) {
+    int x = 0, y = 0, v = 0, h = 0;
+    for (size_t i = 0; i < sim_report_count; ++i) {
+        if (sim_reports[i].kind == SIM_REPORT_MOUSE) {
+            x += sim_reports[i].x;
+            y += sim_reports[i].y;
+            v += sim_reports[i].v;
+            h += sim_reports[i].h;
+        }
+    }
+    return (report_mouse_t){.x = x, .y = y, .v = v, .h = h};
+}
+
+/** \brief Move the sensor by (`x`, `y`) on each of `ms` scans. */
+static void move(int16_t x, int16_t y, uint32_t ms) {
+    for (uint32_t i = 0; i < ms; ++i) {
+        sim_pointer_move(x, y);
+        sim_tick(1);
+    }
+}
+
+static void test_keycodes(void) {
+    setup();
+    keypos_t held   = sim_key(DRGSCRL);
+    keypos_t toggle = sim_key(DRG_TOG);
+
+    move(10, 0, 1);
+    CHECK_EQ(sent().x, 10);
+    sim_press(held.row, held.col);
+    CHECK(drag_scroll_is_enabled());
+    move(10, 0, 1);
+    CHECK_EQ(sent().x, 10);
+    sim_release(held.row, held.col);
+    CHECK(!drag_scroll_is_enabled());
+
+    sim_tap(toggle.row, toggle.col, 20);
+    CHECK(drag_scroll_is_enabled());
+    sim_tap(toggle.row, toggle.col, 20);
+    CHECK(!drag_scroll_is_enabled());
+}
+
+static void test_sub_step_carry_over(void) {
+    setup();
+    drag_scroll_set_enabled(true);
+    // One count per scan, well below a wheel step per report.
+    move(0, 1, DRAG_SCROLL_COUNTS_PER_STEP - 1);
+    CHECK_EQ(sent().v, 0);
+    move(0, 1, 1);
+    CHECK_EQ(sent().v, 1);
+    move(0, 1, 3 * DRAG_SCROLL_COUNTS_PER_STEP);
+    CHECK_EQ(sent().v, 4);
+    // Back the other way: the counts left over are not lost either.
+    move(0, -1, 2 * DRAG_SCROLL_COUNTS_PER_STEP);
+    CHECK_EQ(sent().v, 2);
+    // The pointer does not move meanwhile.
+    CHECK_EQ(sent().x, 0);
+    CHECK_EQ(sent().y, 0);
+}
+
+static void test_axis_lock(void) {
+    setup();
+    drag_scroll_set_enabled(true);
+    // Mostly horizontal: locked to the horizontal axis.
+    move(3, 1, 1);
+    move(1, 5, 2 * DRAG_SCROLL_COUNTS_PER_STEP);
+    CHECK_EQ(sent().v, 0);
+    CHECK_EQ(sent().h, 2);
+
+    // Still locked during a pause shorter than the lock.
+    sim_tick(DRAG_SCROLL_AXIS_LOCK_MS - 10);
+    move(0, 5, 2 * DRAG_SCROLL_COUNTS_PER_STEP);
+    CHECK_EQ(sent().v, 0);
+
+    // Unlocked after the lock time without motion: vertical now.
+    sim_tick(DRAG_SCROLL_AXIS_LOCK_MS);
+    move(0, DRAG_SCROLL_COUNTS_PER_STEP, 2);
+    sim_tick(DRAG_SCROLL_INTERVAL_MS + 1);
+    CHECK_EQ(sent().v, 2);
+    CHECK_EQ(sent().h, 2);
+}
+
+static void test_report_interval(void) {
+    setup();
+    drag_scroll_set_enabled(true);
+    // A wheel step on every scan, for 40 scans.
+    move(0, DRAG_SCROLL_COUNTS_PER_STEP, 40);
+    size_t reports = sim_count_reports(SIM_REPORT_MOUSE);
+    CHECK(reports <= 40 / DRAG_SCROLL_INTERVAL_MS + 1);
+    for (size_t i = 1; i < sim_report_count; ++i) {
+        CHECK(sim_reports[i].time - sim_reports[i - 1].time >= DRAG_SCROLL_INTERVAL_MS);
+    }
+    // The motion in between is merged into the next report.
+    sim_tick(DRAG_SCROLL_INTERVAL_MS + 1);
+    CHECK_EQ(sent().v, 40);
+    CHECK_EQ(sim_count_reports(SIM_REPORT_MOUSE), reports + 1);
+}
+
+int main(void) {
+    RUN_TEST(test_keycodes);
+    RUN_TEST(test_sub_step_carry_over);
+    RUN_TEST(test_axis_lock);
+    RUN_TEST(test_report_interval);
+    TEST_EXIT();
+}
@@ -0,0 +1,209 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "bastardkb.h"
+#include "sim.h"
+#include "test.h"
+
+/*
+ * Encoder batching: wheel detents scaled by the rotation speed and sent in
+ * spaced reports, key detents tapped in batches, queued taps sent first on a
+ * change of direction or layer, and detents only dropped past the opt-in cap
+ * (built again with `ENCODER_BATCH_MAX_PENDING_TAPS`, see the Makefile).
+ */
+
+enum {
+    LAYER_BASE,
+    LAYER_NAV,
+};
+
+#define WHEEL_ENCODER 0
+#define KEY_ENCODER 1
+
+// clang-format off
+static const uint16_t keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
+    [LAYER_BASE] = {
+        {KC_Q,    KC_W,    KC_E,    KC_R,    KC_T},
+        {KC_A,    KC_S,    KC_D,    KC_F,    KC_G},
+        {KC_Z,    KC_X,    KC_C,    KC_V,    KC_B},
+        {KC_NO,   KC_NO,   KC_ESC,  KC_SPC,  MO(LAYER_NAV)},
+        {KC_Y,    KC_U,    KC_I,    KC_O,    KC_P},
+        {KC_H,    KC_J,    KC_K,    KC_L,    KC_QUOTE},
+        {KC_N,    KC_M,    KC_COMM, KC_DOT,  KC_SLSH},
+        {KC_NO,   KC_NO,   KC_ENT,  KC_BSPC, KC_GRAVE},
+    },
+    [LAYER_NAV] = {
+        {KC_NO,   KC_NO,   KC_NO,   KC_NO,   KC_NO},
+        {KC_NO,   KC_NO,   KC_NO,   KC_NO,   KC_NO},
+        {KC_NO,   KC_NO,   KC_NO,   KC_NO,   KC_NO},
+        {KC_NO,   KC_NO,   KC_TRNS, KC_TRNS, KC_TRNS},
+        {KC_NO,   KC_NO,   KC_NO,   KC_NO,   KC_NO},
+        {KC_NO,   KC_NO,   KC_NO,   KC_NO,   KC_NO},
+        {KC_NO,   KC_NO,   KC_NO,   KC_NO,   KC_NO},
+        {KC_NO,   KC_NO,   KC_TRNS, KC_TRNS, KC_TRNS},
+    },
+};
+
+const uint16_t encoder_map[][NUM_ENCODERS][NUM_DIRECTIONS] = {
+    [LAYER_BASE] = {ENCODER_CCW_CW(KC_WH_U, KC_WH_D), ENCODER_CCW_CW(KC_VOLD, KC_VOLU)},
+    [LAYER_NAV]  = {ENCODER_CCW_CW(KC_WH_L, KC_WH_R), ENCODER_CCW_CW(KC_PGUP, KC_PGDN)},
+};
+// clang-format on
+
+static void setup(void) {
+    SIM_INIT(keymaps);
+}
+
+static void turn(uint8_t index, bool clockwise, uint16_t detents) {
+    for (uint16_t i = 0; i < detents; ++i) {
+        sim_encoder(index, clockwise);
+    }
+}
+
+/** \brief Number of taps of the consumer keycode `usage` sent so far. */
+static size_t taps(uint16_t usage) {
+    size_t count = 0;
+    for (size_t i = 0; i < sim_report_count; ++i) {
+        count += sim_reports[i].kind == SIM_REPORT_EXTRA && sim_reports[i].usage == usage;
+    }
+    return count;
+}
+
+/** \brief Sum of the vertical wheel motion sent so far. */
+static int wheel_v(void) {
+    int sum = 0;
+    for (size_t i = 0; i < sim_report_count; ++i) {
+        if (sim_reports[i].kind == SIM_REPORT_MOUSE) {
+            sum += sim_reports[i].v;
+        }
+    }
+    return sum;
+}
+
+static void test_wheel_gain(void) {
+    setup();
+    // Slow detents scroll a single step each.
+    for (uint8_t i = 0; i < 3; ++i) {
+        sim_encoder(WHEEL_ENCODER, true);
+        sim_tick(ENCODER_BATCH_IDLE_MS);
+    }
+    CHECK_EQ(sim_count_reports(SIM_REPORT_MOUSE), 3);
+    CHECK_EQ(wheel_v(), -3);
+
+    // A detent every 10 ms: the smoothed interval goes down from the idle
+    // 200 ms to 105, 57, 33, 21, 15 and 12 ms, each detent scrolling
+    // 60 / interval steps, 1 to 4.
+    sim_clear_reports();
+    sim_tick(1000);
+    for (uint8_t i = 0; i < 20; ++i) {
+        sim_encoder(WHEEL_ENCODER, true);
+        sim_tick(10);
+    }
+    sim_tick(ENCODER_BATCH_WHEEL_INTERVAL_MS);
+    CHECK_EQ(wheel_v(), -(1 + 1 + 1 + 1 + 2 + 15 * ENCODER_BATCH_MAX_GAIN));
+    // Summed in reports at most one per interval.
+    CHECK(sim_count_reports(SIM_REPORT_MOUSE) <= 20 * 10 / ENCODER_BATCH_WHEEL_INTERVAL_MS + 1);
+    for (size_t i = 1; i < sim_report_count; ++i) {
+        CHECK(sim_reports[i].time - sim_reports[i - 1].time >= ENCODER_BATCH_WHEEL_INTERVAL_MS);
+    }
+
+    // Horizontal on the other layer.
+    sim_clear_reports();
+    layer_on(LAYER_NAV);
+    sim_tick(1000);
+    sim_encoder(WHEEL_ENCODER, false);
+    sim_tick(1);
+    CHECK_EQ(sim_count_reports(SIM_REPORT_MOUSE), 1);
+    CHECK_EQ(sim_reports[0].h, -1);
+    CHECK_EQ(sim_reports[0].v, 0);
+}
+
+static void test_key_batches(void) {
+    setup();
+    // Within the cap of the capped build.
+    turn(KEY_ENCODER, true, 8);
+    // The first batch goes right away, then one every interval.
+    CHECK_EQ(taps(KC_VOLU), 1);
+    for (uint8_t batch = 1; batch <= 3; ++batch) {
+        sim_tick(ENCODER_BATCH_KEY_INTERVAL_MS - 1);
+        CHECK_EQ(taps(KC_VOLU), 1 + (batch - 1) * ENCODER_BATCH_TAPS_PER_INTERVAL);
+        sim_tick(1);
+        CHECK_EQ(taps(KC_VOLU), 1 + batch * ENCODER_BATCH_TAPS_PER_INTERVAL);
+    }
+    sim_tick(ENCODER_BATCH_KEY_INTERVAL_MS);
+    CHECK_EQ(taps(KC_VOLU), 8);
+    sim_tick(100);
+    CHECK_EQ(taps(KC_VOLU), 8);
+    // A press and a release each.
+    CHECK_EQ(sim_count_reports(SIM_REPORT_EXTRA), 2 * 8);
+}
+
+static void test_direction_change_flushes(void) {
+    setup();
+    turn(KEY_ENCODER, true, 6);
+    CHECK_EQ(taps(KC_VOLU), 1);
+    // Turning back sends the queued taps first.
+    sim_encoder(KEY_ENCODER, false);
+    CHECK_EQ(taps(KC_VOLU), 6);
+    CHECK_EQ(taps(KC_VOLD), 0);
+    sim_tick(ENCODER_BATCH_KEY_INTERVAL_MS);
+    CHECK_EQ(taps(KC_VOLD), 1);
+}
+
+static void test_layer_change_flushes(void) {
+    setup();
+    keypos_t nav = sim_key(MO(LAYER_NAV));
+    turn(KEY_ENCODER, true, 6);
+    sim_press(nav.row, nav.col);
+    sim_encoder(KEY_ENCODER, true);
+    CHECK_EQ(taps(KC_VOLU), 6);
+    sim_tick(ENCODER_BATCH_KEY_INTERVAL_MS);
+    sim_release(nav.row, nav.col);
+    CHECK_EQ(sim_count_reports(SIM_REPORT_KEYBOARD), 2);
+    // The volume taps all went before the page down.
+    CHECK_EQ(sim_reports[sim_report_count - 2].kind, SIM_REPORT_KEYBOARD);
+    CHECK_EQ(sim_reports[sim_report_count - 2].keys[0], KC_PGDN);
+}
+
+#ifdef ENCODER_BATCH_MAX_PENDING_TAPS
+static void test_detents_past_cap_dropped(void) {
+    setup();
+    // The first detent is tapped right away, the next ones queued up to the cap.
+    turn(KEY_ENCODER, true, 3 * ENCODER_BATCH_MAX_PENDING_TAPS);
+    sim_tick(1000);
+    CHECK_EQ(taps(KC_VOLU), 1 + ENCODER_BATCH_MAX_PENDING_TAPS);
+}
+#else
+static void test_no_detent_dropped(void) {
+    setup();
+    turn(KEY_ENCODER, true, 500);
+    sim_tick(500 / ENCODER_BATCH_TAPS_PER_INTERVAL * ENCODER_BATCH_KEY_INTERVAL_MS);
+    CHECK_EQ(taps(KC_VOLU), 500);
+}
+#endif // ENCODER_BATCH_MAX_PENDING_TAPS
+
+int main(void) {
+    RUN_TEST(test_wheel_gain);
+    RUN_TEST(test_key_batches);
+    RUN_TEST(test_direction_change_flushes);
+    RUN_TEST(test_layer_change_flushes);
+#ifdef ENCODER_BATCH_MAX_PENDING_TAPS
+    RUN_TEST(test_detents_past_cap_dropped);
+#else
+    RUN_TEST(test_no_detent_dropped);
+#endif // ENCODER_BATCH_MAX_PENDING_TAPS
+    TEST_EXIT();
+}
@@ -0,0 +1,94 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "sim.h"
+#include "test.h"
+
+/*
+ * The handsdownneu keymap (Charybdis 4x6), with its tap dance, combos and
+ * layers, and the userspace features it enables.  The keymap is included like
+ * QMK's keymap introspection does, to get the size of its arrays.
+ */
+
+#include KEYMAP_C
+
+static void test_typing(void) {
+    SIM_INIT(keymaps);
+    static const uint16_t text[] = {KC_H, KC_A, KC_N, KC_D, KC_S, KC_SPC, KC_D, KC_O, KC_W, KC_N};
+    for (uint8_t i = 0; i < ARRAY_SIZE(text); ++i) {
+        sim_tap_keycode(text[i], 40);
+        sim_tick(60);
+    }
+    CHECK_STR(sim_typed(), "hands down");
+}
+
+static void test_combo(void) {
+    SIM_INIT(keymaps);
+    keypos_t r = sim_key(KC_R), s = sim_key(KC_S);
+    sim_press(r.row, r.col);
+    sim_tick(10);
+    sim_press(s.row, s.col);
+    sim_tick(40);
+    sim_release(r.row, r.col);
+    sim_release(s.row, s.col);
+    // ß, on the US `-` key.
+    CHECK_STR(sim_typed(), "-");
+}
+
+static void test_combo_layer(void) {
+    SIM_INIT(keymaps);
+    keypos_t navigation = sim_key(NAVIGATION), symbol = sim_key(SYMBOL);
+    sim_press(navigation.row, navigation.col);
+    sim_press(symbol.row, symbol.col);
+    sim_tick(10);
+    CHECK(layer_state_is(LAYER_NUMBERS));
+    sim_tap_keycode(KC_W, 30); // DE_7 on the numbers layer.
+    sim_release(navigation.row, navigation.col);
+    sim_release(symbol.row, symbol.col);
+    CHECK(!layer_state_is(LAYER_NUMBERS));
+    CHECK_STR(sim_typed(), "7");
+}
+
+static void test_q_qu(void) {
+    SIM_INIT(keymaps);
+    // `process_record_keymap` types "qu" on the press, in a single report.
+    sim_tap_keycode(TD(Q_QU), 30);
+    sim_tick(TAPPING_TERM);
+    CHECK_STR(sim_typed(), "qu");
+    CHECK_EQ(sim_count_reports(SIM_REPORT_KEYBOARD), 2);
+}
+
+static void test_replay_trace(void) {
+    static sim_event_t events[64];
+    size_t             count = sim_load_events("traces/handsdownneu.txt", events, ARRAY_SIZE(events));
+    SIM_INIT(keymaps);
+    latency_stats_reset();
+    sim_replay(events, count, NULL);
+    sim_tick(COMBO_TERM);
+    CHECK_STR(sim_typed(), "hands down");
+    // Combo keys wait for the next key, their release, or the first scan after
+    // `COMBO_TERM`.
+    CHECK(latency_stats_get()->input_ms.max <= COMBO_TERM + 1);
+}
+
+int main(void) {
+    RUN_TEST(test_typing);
+    RUN_TEST(test_combo);
+    RUN_TEST(test_combo_layer);
+    RUN_TEST(test_q_qu);
+    RUN_TEST(test_replay_trace);
+    TEST_EXIT();
+}
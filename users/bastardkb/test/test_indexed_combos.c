@@ -0,0 +1,177 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "bastardkb.h"
+#include "sim.h"
+#include "test.h"
+
+/*
+ * Indexed combo engine: combos of two and three keys, a combo layer, the order
+ * of events around held back presses, and combos past `INDEXED_COMBO_MAX_KEYS`
+ * (built with a limit of 8 keys).
+ */
+
+// clang-format off
+static const uint16_t keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
+    {
+        {KC_Q,    KC_W,    KC_E,    KC_R,    KC_T},
+        {KC_A,    KC_S,    KC_D,    KC_F,    KC_G},
+        {KC_Z,    KC_X,    KC_C,    KC_V,    KC_B},
+        {XXXXXXX, XXXXXXX, XXXXXXX, KC_SPC,  XXXXXXX},
+        {KC_Y,    KC_U,    KC_I,    KC_O,    KC_P},
+        {KC_H,    KC_J,    KC_K,    KC_L,    KC_ENT},
+        {KC_N,    KC_M,    KC_COMM, KC_DOT,  XXXXXXX},
+        {KC_BSPC, KC_LSFT, XXXXXXX, XXXXXXX, XXXXXXX},
+    },
+    {
+        {_______, _______, _______, _______, _______},
+        {_______, _______, _______, _______, _______},
+        {_______, _______, _______, _______, _______},
+        {_______, _______, _______, _______, _______},
+        {_______, KC_7,    _______, _______, _______},
+        {_______, _______, _______, _______, _______},
+        {_______, _______, _______, _______, _______},
+        {_______, _______, _______, _______, _______},
+    },
+};
+// clang-format on
+
+static const uint16_t PROGMEM as_combo[]  = {KC_A, KC_S, COMBO_END};
+static const uint16_t PROGMEM asd_combo[] = {KC_A, KC_S, KC_D, COMBO_END};
+static const uint16_t PROGMEM jk_combo[]  = {KC_J, KC_K, COMBO_END};
+// Past the 8 keys of the index.
+static const uint16_t PROGMEM xcv_combo[] = {KC_X, KC_C, KC_V, COMBO_END};
+
+combo_t key_combos[] = {
+    COMBO(as_combo, KC_MINS),
+    COMBO(asd_combo, KC_EQL),
+    COMBO(jk_combo, MO(1)),
+    COMBO(xcv_combo, KC_SLSH),
+};
+const uint16_t key_combos_count = ARRAY_SIZE(key_combos);
+
+static void press_keycode(uint16_t keycode) {
+    keypos_t key = sim_key(keycode);
+    sim_press(key.row, key.col);
+}
+
+static void release_keycode(uint16_t keycode) {
+    keypos_t key = sim_key(keycode);
+    sim_release(key.row, key.col);
+}
+
+static void test_combo(void) {
+    SIM_INIT(keymaps);
+    press_keycode(KC_A);
+    sim_tick(10);
+    press_keycode(KC_S);
+    // A:S:D could still complete until `COMBO_TERM`.
+    sim_tick(10);
+    CHECK_STR(sim_typed(), "");
+    sim_tick(COMBO_TERM);
+    CHECK_STR(sim_typed(), "-");
+    release_keycode(KC_A);
+    release_keycode(KC_S);
+    CHECK_EQ(sim_reports[sim_report_count - 1].keys[0], KC_NO);
+    CHECK_STR(sim_typed(), "-");
+}
+
+static void test_longer_combo(void) {
+    SIM_INIT(keymaps);
+    press_keycode(KC_A);
+    press_keycode(KC_S);
+    sim_tick(10);
+    // Fires right away, no longer combo can complete.
+    press_keycode(KC_D);
+    CHECK_STR(sim_typed(), "=");
+    release_keycode(KC_A);
+    release_keycode(KC_S);
+    release_keycode(KC_D);
+    sim_tick(COMBO_TERM);
+    CHECK_STR(sim_typed(), "=");
+}
+
+static void test_timeout(void) {
+    SIM_INIT(keymaps);
+    press_keycode(KC_A);
+    sim_tick(COMBO_TERM + 1);
+    CHECK_STR(sim_typed(), "a");
+    release_keycode(KC_A);
+    sim_tap_keycode(KC_S, 30);
+    sim_tick(COMBO_TERM);
+    CHECK_STR(sim_typed(), "as");
+}
+
+static void test_other_key_press(void) {
+    SIM_INIT(keymaps);
+    press_keycode(KC_A);
+    press_keycode(KC_Q);
+    CHECK_STR(sim_typed(), "aq");
+    release_keycode(KC_A);
+    release_keycode(KC_Q);
+    CHECK_EQ(sim_reports[sim_report_count - 1].keys[0], KC_NO);
+}
+
+static void test_other_key_release(void) {
+    SIM_INIT(keymaps);
+    press_keycode(KC_LSFT);
+    sim_tick(20);
+    press_keycode(KC_A);
+    sim_tick(10);
+    // Releasing shift must not overtake the held back press.
+    release_keycode(KC_LSFT);
+    sim_tick(10);
+    release_keycode(KC_A);
+    sim_tick(COMBO_TERM);
+    CHECK_STR(sim_typed(), "A");
+    CHECK_EQ(sim_reports[sim_report_count - 1].mods, 0);
+    CHECK_EQ(sim_reports[sim_report_count - 1].keys[0], KC_NO);
+}
+
+static void test_combo_layer(void) {
+    SIM_INIT(keymaps);
+    press_keycode(KC_J);
+    press_keycode(KC_K);
+    sim_tick(10);
+    CHECK(layer_state_is(1));
+    sim_tap(4, 1, 30);
+    release_keycode(KC_J);
+    CHECK(!layer_state_is(1));
+    release_keycode(KC_K);
+    sim_tick(10);
+    CHECK_STR(sim_typed(), "7");
+}
+
+static void test_index_overflow(void) {
+    SIM_INIT(keymaps);
+    CHECK(strstr(sim_console(), "indexed combos: error: 10 combo keys, INDEXED_COMBO_MAX_KEYS is 8") != NULL);
+    press_keycode(KC_X);
+    press_keycode(KC_C);
+    press_keycode(KC_V);
+    sim_tick(COMBO_TERM);
+    CHECK_STR(sim_typed(), "xcv");
+}
+
+int main(void) {
+    RUN_TEST(test_combo);
+    RUN_TEST(test_longer_combo);
+    RUN_TEST(test_timeout);
+    RUN_TEST(test_other_key_press);
+    RUN_TEST(test_other_key_release);
+    RUN_TEST(test_combo_layer);
+    RUN_TEST(test_index_overflow);
+    TEST_EXIT();
+}
@@ -0,0 +1,150 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "bastardkb.h"
+#include "sim.h"
+#include "test.h"
+
+/*
+ * Key event latency, through the whole userspace: the latency figures of
+ * `latency.c`, and a replay of a long typing session measuring the host time
+ * spent per event and the input latency seen by the host.
+ */
+
+enum { KB_KEY = SAFE_RANGE };
+
+// clang-format off
+static const uint16_t keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
+    {
+        {KC_Q,         KC_W,    KC_E,    KC_R,             KC_T},
+        {LCTL_T(KC_A), KC_S,    KC_D,    KC_F,             KC_G},
+        {KC_Z,         KC_X,    KC_C,    KC_V,             KC_B},
+        {XXXXXXX,      XXXXXXX, XXXXXXX, LT(1, KC_SPC),    KB_KEY},
+        {KC_Y,         KC_U,    KC_I,    KC_O,             KC_P},
+        {KC_H,         KC_J,    KC_K,    KC_L,             KC_ENT},
+        {KC_N,         KC_M,    KC_COMM, KC_DOT,           XXXXXXX},
+        {KC_BSPC,      KC_LSFT, XXXXXXX, XXXXXXX,          XXXXXXX},
+    },
+    {
+        {KC_1,    KC_2,    KC_3,    KC_4,    KC_5},
+        {_______, _______, _______, _______, _______},
+        {_______, _______, _______, _______, _______},
+        {_______, _______, _______, _______, _______},
+        {KC_6,    KC_7,    KC_8,    KC_9,    KC_0},
+        {_______, _______, _______, _______, _______},
+        {_______, _______, _______, _______, _______},
+        {_______, _______, _______, _______, _______},
+    },
+};
+// clang-format on
+
+static bool kb_returns_false(uint16_t keycode, keyrecord_t *record) {
+    // Like a keyboard-level keycode (eg. `DRAGSCROLL_MODE`) handled in `process_record_kb`.
+    return keycode != KB_KEY;
+}
+
+static uint16_t housekeeping_tap = KC_NO;
+
+void housekeeping_task_keymap(void) {
+    if (housekeeping_tap != KC_NO) {
+        tap_code16(housekeeping_tap);
+        housekeeping_tap = KC_NO;
+    }
+}
+
+static void test_plain_key(void) {
+    SIM_INIT(keymaps);
+    sim_tick(10);
+    latency_stats_reset();
+    sim_tap(0, 0, 30);
+    sim_tick(10);
+    const latency_stats_t *stats = latency_stats_get();
+    CHECK_STR(sim_typed(), "q");
+    CHECK_EQ(stats->process_us.count, 2);
+    CHECK_EQ(stats->report_us.count, 2);
+    CHECK_EQ(stats->input_ms.count, 2);
+    CHECK_EQ(stats->input_ms.max, 0);
+}
+
+static void test_event_stopped_by_keyboard(void) {
+    SIM_INIT(keymaps);
+    sim_process_record_kb = kb_returns_false;
+    sim_tick(10);
+    latency_stats_reset();
+    // `post_process_record_user` is skipped for this key.
+    sim_tap(3, 4, 30);
+    sim_tick(20);
+    // A report sent outside of any event's processing must not be charged to
+    // the key above.
+    housekeeping_tap = KC_X;
+    sim_tick(1);
+    CHECK_STR(sim_typed(), "x");
+    CHECK_EQ(latency_stats_get()->report_us.count, 0);
+}
+
+static uint32_t benchmark_random = 1;
+
+static uint32_t benchmark_next(uint32_t range) {
+    benchmark_random = benchmark_random * 1103515245 + 12345;
+    return (benchmark_random >> 16) % range;
+}
+
+static void test_typing_benchmark(void) {
+    static const keypos_t letters[] = {
+        {.row = 0, .col = 0}, {.row = 0, .col = 3}, {.row = 0, .col = 4}, {.row = 1, .col = 1}, {.row = 1, .col = 2}, {.row = 1, .col = 3},
+        {.row = 2, .col = 0}, {.row = 2, .col = 2}, {.row = 4, .col = 1}, {.row = 4, .col = 2}, {.row = 4, .col = 3}, {.row = 5, .col = 0},
+        {.row = 5, .col = 1}, {.row = 5, .col = 2}, {.row = 5, .col = 3}, {.row = 6, .col = 0}, {.row = 6, .col = 1},
+    };
+    static sim_event_t events[4000];
+    static char        expected[ARRAY_SIZE(events) / 2 + 1];
+    uint32_t           time = 0;
+
+    for (size_t i = 0; i < ARRAY_SIZE(events) / 2; ++i) {
+        keypos_t key  = letters[benchmark_next(ARRAY_SIZE(letters))];
+        uint32_t pick = benchmark_next(10);
+        if (pick == 0) {
+            key = (keypos_t){.row = 3, .col = 3}; // Space, a layer-tap key.
+        } else if (pick == 1) {
+            key = (keypos_t){.row = 1, .col = 0}; // A, a mod-tap key.
+        }
+        // Pressed 40-160 ms after the previous key, held 30-90 ms.
+        time += 40 + benchmark_next(120);
+        events[i * 2] = (sim_event_t){.time = time, .row = key.row, .col = key.col, .pressed = true};
+        time += 30 + benchmark_next(60);
+        events[i * 2 + 1] = (sim_event_t){.time = time, .row = key.row, .col = key.col, .pressed = false};
+        expected[i]       = pick == 0 ? ' ' : 'a' + keymaps[0][key.row][key.col] - KC_A;
+    }
+
+    SIM_INIT(keymaps);
+    sim_tick(10);
+    latency_stats_reset();
+    sim_replay_stats_t replay = {0};
+    sim_replay(events, ARRAY_SIZE(events), &replay);
+    sim_tick(TAPPING_TERM);
+
+    const latency_stats_t *stats = latency_stats_get();
+    CHECK_STR(sim_typed(), expected);
+    CHECK_EQ(stats->process_us.count, ARRAY_SIZE(events));
+    CHECK(stats->input_ms.max < TAPPING_TERM);
+    printf("    %zu events: host %llu ns/event (max %llu ns), input latency min %lu avg %lu max %lu ms\n", replay.events, (unsigned long long)(replay.total_ns / replay.events), (unsigned long long)replay.max_ns, (unsigned long)stats->input_ms.min, (unsigned long)(stats->input_ms.total / stats->input_ms.count), (unsigned long)stats->input_ms.max);
+}
+
+int main(void) {
+    RUN_TEST(test_plain_key);
+    RUN_TEST(test_event_stopped_by_keyboard);
+    RUN_TEST(test_typing_benchmark);
+    TEST_EXIT();
+}
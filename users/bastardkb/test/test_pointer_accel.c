@@ -0,0 +1,92 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "bastardkb.h"
+#include "sim.h"
+#include "test.h"
+
+/*
+ * Pointer acceleration with the default curve: gains at low and high speed,
+ * fractional counts carried over, and dropped on a change of direction or
+ * after a pause.
+ */
+
+static int16_t move_x(int16_t x) {
+    report_mouse_t report = {.x = x};
+    return pointer_accel_apply(report).x;
+}
+
+static void setup(void) {
+    sim_init(NULL, 0);
+    pointer_accel_reset();
+}
+
+static void test_gain(void) {
+    setup();
+    CHECK_EQ(POINTER_ACCEL_GAIN(0), POINTER_ACCEL_MIN_GAIN);
+    CHECK_EQ(POINTER_ACCEL_GAIN(POINTER_ACCEL_OFFSET), (POINTER_ACCEL_MIN_GAIN + POINTER_ACCEL_MAX_GAIN) / 2);
+    // 40 * 720 / 256 = 112.5
+    CHECK_EQ(move_x(40), 112);
+    pointer_accel_reset();
+    CHECK_EQ(move_x(-40), -112);
+    // Clamped to the report range.
+    CHECK_EQ(move_x(100), INT8_MAX);
+    // Both axes get the gain of the combined speed, 24 + 24 / 2.
+    pointer_accel_reset();
+    report_mouse_t report = pointer_accel_apply((report_mouse_t){.x = 24, .y = -24});
+    CHECK_EQ(report.x, 24 * POINTER_ACCEL_GAIN(36) / 256);
+    CHECK_EQ(report.y, -24 * POINTER_ACCEL_GAIN(36) / 256);
+}
+
+static void test_slow_motion_carried_over(void) {
+    setup();
+    // A gain of 195/256 at 1 count per report: 3 counts out of 4.
+    int16_t total = 0;
+    for (uint8_t i = 0; i < 4; ++i) {
+        total += move_x(1);
+        sim_tick(8);
+    }
+    CHECK_EQ(total, 3);
+}
+
+static void test_direction_change(void) {
+    setup();
+    CHECK_EQ(move_x(1), 0);
+    // The 195/256 left over are not taken off the motion back.
+    CHECK_EQ(move_x(-1), 0);
+    CHECK_EQ(move_x(-1), -1);
+}
+
+static void test_pause(void) {
+    setup();
+    CHECK_EQ(move_x(1), 0);
+    sim_tick(POINTER_ACCEL_REMAINDER_TIMEOUT_MS / 2);
+    CHECK_EQ(move_x(0), 0);
+    // The 195/256 left over are kept over a short pause.
+    CHECK_EQ(move_x(1), 1);
+    sim_tick(POINTER_ACCEL_REMAINDER_TIMEOUT_MS + 1);
+    CHECK_EQ(move_x(0), 0);
+    // The 134/256 left over before the pause are dropped.
+    CHECK_EQ(move_x(1), 0);
+}
+
+int main(void) {
+    RUN_TEST(test_gain);
+    RUN_TEST(test_slow_motion_carried_over);
+    RUN_TEST(test_direction_change);
+    RUN_TEST(test_pause);
+    TEST_EXIT();
+}
@@ -0,0 +1,198 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "bastardkb.h"
+#include "sim.h"
+#include "test.h"
+
+/*
+ * RGB layer indicators: the LEDs written on a layer change, none while the
+ * layer state does not change, and no LED driver flush of their own.
+ */
+
+enum {
+    LAYER_BASE,
+    LAYER_NUMBERS,
+    LAYER_SYMBOLS,
+};
+
+// clang-format off
+static const uint16_t keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
+    [LAYER_BASE] = {
+        {KC_Q,    KC_W,    KC_E,    KC_R,    KC_T},
+        {KC_A,    KC_S,    KC_D,    KC_F,    KC_G},
+        {KC_Z,    KC_X,    KC_C,    KC_V,    KC_B},
+        {KC_NO,   KC_NO,   KC_ESC,  KC_SPC,  KC_TAB},
+        {KC_Y,    KC_U,    KC_I,    KC_O,    KC_P},
+        {KC_H,    KC_J,    KC_K,    KC_L,    KC_QUOTE},
+        {KC_N,    KC_M,    KC_COMM, KC_DOT,  KC_SLSH},
+        {KC_NO,   KC_NO,   KC_ENT,  KC_BSPC, KC_GRAVE},
+    },
+    [LAYER_NUMBERS] = {
+        {KC_1,    KC_2,    KC_3,    KC_4,    KC_5},
+        {KC_NO,   KC_NO,   KC_NO,   KC_NO,   KC_NO},
+        {KC_NO,   KC_NO,   KC_NO,   KC_NO,   KC_NO},
+        {KC_NO,   KC_NO,   KC_TRNS, KC_TRNS, KC_TRNS},
+        {KC_6,    KC_7,    KC_8,    KC_9,    KC_0},
+        {KC_NO,   KC_NO,   KC_NO,   KC_NO,   KC_NO},
+        {KC_NO,   KC_NO,   KC_NO,   KC_NO,   KC_NO},
+        {KC_NO,   KC_NO,   KC_TRNS, KC_TRNS, KC_TRNS},
+    },
+    // The numbers layer, with symbols on the second row.
+    [LAYER_SYMBOLS] = {
+        {KC_1,    KC_2,    KC_3,    KC_4,    KC_5},
+        {KC_MINS, KC_EQL,  KC_LBRC, KC_RBRC, KC_QUOTE},
+        {KC_NO,   KC_NO,   KC_NO,   KC_NO,   KC_NO},
+        {KC_NO,   KC_NO,   KC_TRNS, KC_TRNS, KC_TRNS},
+        {KC_6,    KC_7,    KC_8,    KC_9,    KC_0},
+        {KC_NO,   KC_NO,   KC_NO,   KC_NO,   KC_NO},
+        {KC_NO,   KC_NO,   KC_NO,   KC_NO,   KC_NO},
+        {KC_NO,   KC_NO,   KC_TRNS, KC_TRNS, KC_TRNS},
+    },
+};
+// clang-format on
+
+// One LED per key, `row * MATRIX_COLS + col`, then 2 underglow LEDs.
+#define KEY_LEDS (MATRIX_ROWS * MATRIX_COLS)
+_Static_assert(RGB_MATRIX_LED_COUNT == KEY_LEDS + 2, "One LED per key, and 2 underglow LEDs");
+
+led_config_t g_led_config;
+
+/** \brief Mapped keys on each layer, and the underglow. */
+#define NUMBERS_LIT (10 + 2)
+#define SYMBOLS_LIT (NUMBERS_LIT + 5)
+
+bool rgb_indicator_layer_color_keymap(uint8_t layer, HSV *hsv) {
+    switch (layer) {
+        case LAYER_NUMBERS:
+        case LAYER_SYMBOLS:
+            *hsv = (HSV){HSV_GREEN};
+            return true;
+        default:
+            return false;
+    }
+}
+
+static void setup(void) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; ++row) {
+        for (uint8_t col = 0; col < MATRIX_COLS; ++col) {
+            g_led_config.matrix_co[row][col] = row * MATRIX_COLS + col;
+        }
+    }
+    SIM_INIT(keymaps);
+    // Let the indicator see the layer state reset, after the previous test.
+    sim_tick(1);
+}
+
+/** \brief Wait for the effect to be switched off, and for a whole repaint. */
+static void settle(void) {
+    sim_tick(RGB_INDICATOR_START_DELAY_MS + RGB_MATRIX_LED_COUNT / RGB_INDICATOR_LEDS_PER_TASK + 1);
+}
+
+static bool led_is(uint8_t led, RGB color) {
+    return memcmp(&sim_rgb_leds[led], &color, sizeof(RGB)) == 0;
+}
+
+static size_t leds_lit(void) {
+    size_t lit = 0;
+    for (uint8_t led = 0; led < RGB_MATRIX_LED_COUNT; ++led) {
+        lit += !led_is(led, (RGB){0});
+    }
+    return lit;
+}
+
+static void test_layer_painted(void) {
+    setup();
+    settle();
+    CHECK_EQ(sim_rgb_writes, 0);
+
+    layer_on(LAYER_NUMBERS);
+    settle();
+    RGB green = hsv_to_rgb((HSV){HSV_GREEN});
+    CHECK_EQ(rgb_matrix_get_mode(), RGB_MATRIX_NONE);
+    CHECK(led_is(0, green));                             // KC_1
+    CHECK(led_is(MATRIX_COLS, (RGB){0}));                // KC_NO
+    CHECK(led_is(3 * MATRIX_COLS + 2, (RGB){0}));        // KC_TRNS
+    CHECK(led_is(KEY_LEDS, green) && led_is(KEY_LEDS + 1, green));
+    CHECK_EQ(leds_lit(), NUMBERS_LIT);
+    // LEDs turned off by the effect switch are not written again.
+    CHECK_EQ(sim_rgb_writes, NUMBERS_LIT);
+    // Left to QMK's render cycle.
+    CHECK_EQ(sim_rgb_flushes, 0);
+
+    layer_off(LAYER_NUMBERS);
+    sim_tick(1);
+    CHECK_EQ(rgb_matrix_get_mode(), RGB_MATRIX_DEFAULT_MODE);
+}
+
+static void test_unchanged_layer_not_repainted(void) {
+    setup();
+    layer_on(LAYER_NUMBERS);
+    settle();
+    size_t writes = sim_rgb_writes;
+
+    sim_tick(1000);
+    CHECK_EQ(sim_rgb_writes, writes);
+    // Turning on a layer below does not change the indicator.
+    layer_on(LAYER_BASE);
+    sim_tick(1000);
+    CHECK_EQ(sim_rgb_writes, writes);
+    CHECK_EQ(sim_rgb_flushes, 0);
+}
+
+static void test_only_changed_leds_written(void) {
+    setup();
+    layer_on(LAYER_NUMBERS);
+    settle();
+    size_t writes = sim_rgb_writes;
+
+    // Same color: only the symbols are written.
+    layer_on(LAYER_SYMBOLS);
+    sim_tick(RGB_MATRIX_LED_COUNT / RGB_INDICATOR_LEDS_PER_TASK + 1);
+    CHECK_EQ(sim_rgb_writes, writes + SYMBOLS_LIT - NUMBERS_LIT);
+    CHECK_EQ(leds_lit(), SYMBOLS_LIT);
+
+    layer_off(LAYER_SYMBOLS);
+    sim_tick(RGB_MATRIX_LED_COUNT / RGB_INDICATOR_LEDS_PER_TASK + 1);
+    CHECK_EQ(sim_rgb_writes, writes + 2 * (SYMBOLS_LIT - NUMBERS_LIT));
+    CHECK_EQ(leds_lit(), NUMBERS_LIT);
+    CHECK_EQ(sim_rgb_flushes, 0);
+}
+
+static void test_repainted_after_enable(void) {
+    setup();
+    layer_on(LAYER_NUMBERS);
+    settle();
+
+    rgb_matrix_disable_noeeprom();
+    sim_tick(100);
+    CHECK_EQ(leds_lit(), 0);
+    size_t writes = sim_rgb_writes;
+
+    // The LEDs were cleared: all written again, the unlit ones too.
+    rgb_matrix_enable_noeeprom();
+    settle();
+    CHECK_EQ(sim_rgb_writes, writes + RGB_MATRIX_LED_COUNT);
+    CHECK_EQ(leds_lit(), NUMBERS_LIT);
+}
+
+int main(void) {
+    RUN_TEST(test_layer_painted);
+    RUN_TEST(test_unchanged_layer_not_repainted);
+    RUN_TEST(test_only_changed_leds_written);
+    RUN_TEST(test_repainted_after_enable);
+    TEST_EXIT();
+}
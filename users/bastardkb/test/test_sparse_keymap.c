@@ -0,0 +1,67 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "sim.h"
+#include "test.h"
+
+/*
+ * The sparse keymap of the handsdownneu keymap: the same keycode as the dense
+ * `keymaps` array on every key of every layer, and the keymap's tests typed
+ * through it.
+ */
+
+#include KEYMAP_C
+
+static void test_every_key(void) {
+    size_t mismatches = 0;
+    for (uint8_t layer = 0; layer < ARRAY_SIZE(keymaps); ++layer) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; ++row) {
+            for (uint8_t col = 0; col < MATRIX_COLS; ++col) {
+                uint16_t keycode = keycode_at_keymap_location(layer, row, col);
+                if (keycode != keymaps[layer][row][col]) {
+                    fprintf(stderr, "layer %u, row %u, col %u: 0x%04X, expected 0x%04X\n", layer, row, col, keycode, keymaps[layer][row][col]);
+                    ++mismatches;
+                }
+            }
+        }
+    }
+    CHECK_EQ(mismatches, 0);
+    CHECK_EQ(sparse_keymap_layer_count, ARRAY_SIZE(keymaps));
+}
+
+static void test_out_of_range(void) {
+    // As QMK's dense lookup.
+    CHECK_EQ(keycode_at_keymap_location(ARRAY_SIZE(keymaps), 0, 0), KC_TRNS);
+    CHECK_EQ(keycode_at_keymap_location(0, MATRIX_ROWS, 0), KC_TRNS);
+    CHECK_EQ(keycode_at_keymap_location(0, 0, MATRIX_COLS), KC_TRNS);
+}
+
+static void test_typing(void) {
+    SIM_INIT(keymaps);
+    static const uint16_t text[] = {KC_H, KC_A, KC_N, KC_D, KC_S, KC_SPC, KC_D, KC_O, KC_W, KC_N};
+    for (uint8_t i = 0; i < ARRAY_SIZE(text); ++i) {
+        sim_tap_keycode(text[i], 40);
+        sim_tick(60);
+    }
+    CHECK_STR(sim_typed(), "hands down");
+}
+
+int main(void) {
+    RUN_TEST(test_every_key);
+    RUN_TEST(test_out_of_range);
+    RUN_TEST(test_typing);
+    TEST_EXIT();
+}
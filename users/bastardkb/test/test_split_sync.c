@@ -0,0 +1,139 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "bastardkb.h"
+#include "sim.h"
+#include "test.h"
+
+/*
+ * Split state sync: only changed fields sent, all of them on a forced sync,
+ * failed transactions retried with a growing delay, and statistics that do not
+ * wrap.  Built with a 10 s statistics window, see the Makefile.
+ */
+
+static uint8_t  mode;
+static uint16_t dpi;
+static uint32_t counter;
+
+static uint8_t received_fields;
+
+void split_sync_received_keymap(uint8_t fields) {
+    received_fields |= fields;
+}
+
+/** \brief Start with every field in sync. */
+static void setup(void) {
+    sim_init(NULL, 0);
+    sim_tick(1);
+    sim_split_transactions = 0;
+    received_fields        = 0;
+}
+
+static void test_unchanged_not_sent(void) {
+    setup();
+    sim_tick(SPLIT_SYNC_FORCED_SYNC_MS - 10);
+    CHECK_EQ(sim_split_transactions, 0);
+}
+
+static void test_only_changed_fields_sent(void) {
+    setup();
+    dpi = 1200;
+    sim_tick(1);
+    CHECK_EQ(sim_split_transactions, 1);
+    // Sequence number, field mask and the field.
+    CHECK_EQ(sim_split_request_size, 2 + sizeof(dpi));
+    CHECK_EQ(sim_split_request[1], 1 << 1);
+    CHECK_EQ(sim_split_request[2] | sim_split_request[3] << 8, 1200);
+    CHECK_EQ(received_fields, 1 << 1);
+
+    mode    = 3;
+    counter = 7;
+    sim_tick(1);
+    CHECK_EQ(sim_split_transactions, 2);
+    CHECK_EQ(sim_split_request_size, 2 + sizeof(mode) + sizeof(counter));
+    CHECK_EQ(sim_split_request[1], 1 << 0 | 1 << 2);
+    CHECK_EQ(sim_split_request[2], 3);
+
+    sim_tick(10);
+    CHECK_EQ(sim_split_transactions, 2);
+}
+
+static void test_forced_sync(void) {
+    setup();
+    sim_tick(SPLIT_SYNC_FORCED_SYNC_MS);
+    CHECK_EQ(sim_split_transactions, 1);
+    CHECK_EQ(sim_split_request[1], 0x07);
+    CHECK_EQ(sim_split_request_size, 2 + sizeof(mode) + sizeof(dpi) + sizeof(counter));
+}
+
+static void test_retry_backoff(void) {
+    setup();
+    sim_split_connected = false;
+    ++mode;
+    sim_tick(1);
+    CHECK_EQ(sim_split_transactions, 1);
+    // No retry before the delay, then the delay doubles.
+    sim_tick(SPLIT_SYNC_RETRY_MS - 1);
+    CHECK_EQ(sim_split_transactions, 1);
+    sim_tick(1);
+    CHECK_EQ(sim_split_transactions, 2);
+    sim_tick(2 * SPLIT_SYNC_RETRY_MS - 1);
+    CHECK_EQ(sim_split_transactions, 2);
+    sim_tick(1);
+    CHECK_EQ(sim_split_transactions, 3);
+    // Then 32, 64 ... 512 ms, and once per forced sync interval: 14 more in 10 s.
+    sim_tick(10000);
+    CHECK_EQ(sim_split_transactions, 3 + 5 + 9);
+
+    // Sent on the next retry once the link is back, then without delay.
+    size_t failed       = sim_split_transactions;
+    sim_split_connected = true;
+    sim_tick(SPLIT_SYNC_FORCED_SYNC_MS);
+    CHECK_EQ(sim_split_transactions, failed + 1);
+    CHECK_EQ(received_fields, 0x07);
+    ++dpi;
+    sim_tick(1);
+    CHECK_EQ(sim_split_transactions, failed + 2);
+}
+
+static void test_stats_do_not_wrap(void) {
+    setup();
+    // The first window, started by `sim_init`, ends on the next loop iteration.
+    sim_tick(SPLIT_SYNC_STATS_INTERVAL_MS - 2);
+    // A change every loop iteration, for a whole window.
+    for (uint32_t i = 0; i < SPLIT_SYNC_STATS_INTERVAL_MS; ++i) {
+        ++counter;
+        sim_tick(1);
+    }
+    sim_tick(1);
+    split_sync_stats_t stats = split_sync_stats_get();
+    CHECK_EQ(stats.transfers, SPLIT_SYNC_STATS_INTERVAL_MS);
+    CHECK(stats.bytes > UINT16_MAX);
+    CHECK_EQ(stats.failures, 0);
+}
+
+int main(void) {
+    split_sync_register(&mode, sizeof(mode));
+    split_sync_register(&dpi, sizeof(dpi));
+    split_sync_register(&counter, sizeof(counter));
+
+    RUN_TEST(test_unchanged_not_sent);
+    RUN_TEST(test_only_changed_fields_sent);
+    RUN_TEST(test_forced_sync);
+    RUN_TEST(test_retry_backoff);
+    RUN_TEST(test_stats_do_not_wrap);
+    TEST_EXIT();
+}
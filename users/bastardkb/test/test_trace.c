@@ -0,0 +1,215 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "bastardkb.h"
+#include "sim.h"
+#include "test.h"
+
+/*
+ * Key event trace: the records of key events, of events swallowed by the combo
+ * engine, of long idle gaps and of a full buffer, read back over raw HID.
+ */
+
+// clang-format off
+static const uint16_t keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
+    {
+        {KC_Q,    KC_W,    KC_E,    KC_R,    KC_T},
+        {LSFT_T(KC_A), KC_S, KC_D,  KC_F,    KC_G},
+        {KC_Z,    KC_X,    KC_C,    KC_V,    KC_B},
+        {XXXXXXX, XXXXXXX, XXXXXXX, KC_SPC,  XXXXXXX},
+        {KC_Y,    KC_U,    KC_I,    KC_O,    KC_P},
+        {KC_H,    KC_J,    KC_K,    KC_L,    KC_ENT},
+        {KC_N,    KC_M,    KC_COMM, KC_DOT,  XXXXXXX},
+        {KC_BSPC, KC_LSFT, XXXXXXX, XXXXXXX, XXXXXXX},
+    },
+};
+// clang-format on
+
+static const uint16_t PROGMEM jk_combo[] = {KC_J, KC_K, COMBO_END};
+
+combo_t key_combos[] = {
+    COMBO(jk_combo, KC_MINS),
+};
+const uint16_t key_combos_count = ARRAY_SIZE(key_combos);
+
+typedef struct {
+    uint8_t  key;
+    uint8_t  flags;
+    uint16_t keycode;
+    uint8_t  tap;
+    int32_t  delta;
+} record_t;
+
+static record_t records[512];
+static size_t   record_count;
+static uint16_t dropped;
+
+static void trace_command(uint8_t command, uint16_t argument) {
+    uint8_t data[RAW_EPSIZE] = {RAW_HID_TRACE, command, argument & 0xFF, argument >> 8};
+    trace_raw_hid(data, sizeof(data));
+    memcpy(sim_raw_hid_report, data, sizeof(data));
+}
+
+/** \brief Read the trace as `util/trace.py` does, then clear it. */
+static void read_trace(void) {
+    static uint8_t buffer[TRACE_BUFFER_SIZE];
+    trace_command(TRACE_RAW_HID_PAUSE, 0);
+    uint16_t used = sim_raw_hid_report[2] | sim_raw_hid_report[3] << 8;
+    dropped       = sim_raw_hid_report[4] | sim_raw_hid_report[5] << 8;
+    for (uint16_t offset = 0; offset < used;) {
+        trace_command(TRACE_RAW_HID_READ, offset);
+        memcpy(&buffer[offset], &sim_raw_hid_report[5], sim_raw_hid_report[4]);
+        offset += sim_raw_hid_report[4];
+    }
+    trace_command(TRACE_RAW_HID_RESUME, 1);
+
+    record_count = 0;
+    for (uint16_t position = 0; position < used; ++record_count) {
+        record_t *record = &records[record_count];
+        *record          = (record_t){.key = buffer[position], .flags = buffer[position + 1]};
+        position += 2;
+        if ((record->flags & TRACE_KIND_MASK) != TRACE_EVENT) {
+            record->keycode = buffer[position] | buffer[position + 1] << 8;
+            position += 2;
+        }
+        if ((record->flags & TRACE_KIND_MASK) == TRACE_PROCESS) {
+            record->tap = buffer[position++];
+        }
+        uint32_t zigzag = 0;
+        for (uint8_t shift = 0;; shift += 7) {
+            zigzag |= (uint32_t)(buffer[position] & 0x7F) << shift;
+            if (!(buffer[position++] & 0x80)) {
+                break;
+            }
+        }
+        record->delta = (int32_t)(zigzag >> 1) ^ -(int32_t)(zigzag & 1);
+    }
+}
+
+static bool record_is(size_t index, uint8_t key, uint8_t flags, uint16_t keycode) {
+    return index < record_count && records[index].key == key && (records[index].flags & ~TRACE_LAYER_MASK) == flags && records[index].keycode == keycode;
+}
+
+static void test_key(void) {
+    SIM_INIT(keymaps);
+    read_trace();
+    sim_tick(10);
+    sim_tap(0, 1, 30);
+    read_trace();
+    CHECK_EQ(record_count, 4);
+    CHECK(record_is(0, 0x01, TRACE_EVENT | TRACE_PRESSED, 0));
+    CHECK(record_is(1, 0x01, TRACE_PROCESS | TRACE_PRESSED, KC_W));
+    CHECK(record_is(2, 0x01, TRACE_EVENT, 0));
+    CHECK(record_is(3, 0x01, TRACE_PROCESS, KC_W));
+    CHECK_EQ(records[1].delta, 0);
+    CHECK_EQ(records[2].delta, 30);
+}
+
+static void test_tap_hold(void) {
+    SIM_INIT(keymaps);
+    read_trace();
+    sim_press(1, 0);
+    sim_tick(20);
+    sim_tap(0, 1, 10);
+    sim_tick(10);
+    sim_release(1, 0);
+    read_trace();
+    // `W` is held back until `LSFT_T(KC_A)` is released: its events are
+    // recorded when scanned, and again once processed.
+    CHECK_EQ(record_count, 8);
+    CHECK(record_is(0, 0x10, TRACE_EVENT | TRACE_PRESSED, 0));
+    CHECK(record_is(1, 0x01, TRACE_EVENT | TRACE_PRESSED, 0));
+    CHECK(record_is(2, 0x01, TRACE_EVENT, 0));
+    CHECK(record_is(3, 0x10, TRACE_EVENT, 0));
+    CHECK(record_is(4, 0x10, TRACE_PROCESS | TRACE_PRESSED, LSFT_T(KC_A)));
+    CHECK_EQ(records[4].tap, 1 | TRACE_TAP_INTERRUPTED);
+    CHECK_EQ(records[4].delta, -40);
+    CHECK(record_is(5, 0x01, TRACE_PROCESS | TRACE_PRESSED, KC_W));
+    CHECK(record_is(6, 0x01, TRACE_PROCESS, KC_W));
+    CHECK(record_is(7, 0x10, TRACE_PROCESS, LSFT_T(KC_A)));
+    CHECK_EQ(records[7].tap, 1);
+}
+
+static void test_combo(void) {
+    SIM_INIT(keymaps);
+    read_trace();
+    sim_press(5, 1);
+    sim_tick(10);
+    sim_press(5, 2);
+    sim_tick(50);
+    sim_release(5, 1);
+    sim_release(5, 2);
+    read_trace();
+    // The presses never reach `process_record`.
+    CHECK_EQ(record_count, 6);
+    CHECK(record_is(0, 0x51, TRACE_EVENT | TRACE_PRESSED, 0));
+    CHECK(record_is(1, 0x52, TRACE_EVENT | TRACE_PRESSED, 0));
+    CHECK(record_is(2, 0x52, TRACE_ACTION | TRACE_PRESSED, KC_MINS));
+    CHECK(record_is(3, 0x51, TRACE_EVENT, 0));
+    CHECK(record_is(4, 0x51, TRACE_ACTION, KC_MINS));
+    CHECK(record_is(5, 0x52, TRACE_EVENT, 0));
+
+    // A press replayed when the combo doesn't complete is recorded once.
+    sim_press(5, 1);
+    sim_tick(COMBO_TERM + 10);
+    sim_release(5, 1);
+    read_trace();
+    CHECK_EQ(record_count, 4);
+    CHECK(record_is(0, 0x51, TRACE_EVENT | TRACE_PRESSED, 0));
+    CHECK(record_is(1, 0x51, TRACE_PROCESS | TRACE_PRESSED, KC_J));
+    CHECK(record_is(2, 0x51, TRACE_EVENT, 0));
+    CHECK(record_is(3, 0x51, TRACE_PROCESS, KC_J));
+}
+
+static void test_idle(void) {
+    SIM_INIT(keymaps);
+    read_trace();
+    sim_tap(0, 1, 10);
+    // The 16-bit delta would wrap around to a short one.
+    sim_tick(65536 + 40);
+    sim_tap(0, 1, 10);
+    read_trace();
+    CHECK_EQ(record_count, 8);
+    CHECK_EQ(records[4].delta, INT16_MAX);
+    CHECK_EQ(records[5].delta, 0);
+    CHECK_EQ(records[6].delta, 10);
+}
+
+static void test_full(void) {
+    SIM_INIT(keymaps);
+    read_trace();
+    for (int i = 0; i < 200; ++i) {
+        sim_tap(0, 1, 10);
+        sim_tick(10);
+    }
+    read_trace();
+    CHECK(dropped > 0);
+    // 800 records, each 3 or 5 bytes long.
+    CHECK_EQ(record_count + dropped, 800);
+    for (size_t i = 0; i < record_count; ++i) {
+        CHECK(records[i].key == 0x01);
+        CHECK(i == 0 || records[i].delta == ((records[i].flags & TRACE_KIND_MASK) == TRACE_EVENT ? 10 : 0));
+    }
+}
+
+int main(void) {
+    RUN_TEST(test_key);
+    RUN_TEST(test_tap_hold);
+    RUN_TEST(test_combo);
+    RUN_TEST(test_idle);
+    RUN_TEST(test_full);
+    TEST_EXIT();
+}
@@ -0,0 +1,80 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <stdint.h>
+#include "timer.h"
+
+#ifdef PROTOCOL_CHIBIOS
+#    include <ch.h>
+#endif // PROTOCOL_CHIBIOS
+
+/*
+ * Short interval timing.
+ *
+ * QMK's own timer only has millisecond resolution, which is too coarse to
+ * measure the cost of a single callback.  On ChibiOS the system tick is used
+ * instead (its resolution depends on `CH_CFG_ST_FREQUENCY`).  Other platforms
+ * fall back to the millisecond timer.
+ */
+
+#ifdef PROTOCOL_CHIBIOS
+typedef systime_t timing_t;
+
+/** \brief Return an opaque timestamp for use with `timing_elapsed_us`. */
+static inline timing_t timing_read(void) {
+    return chVTGetSystemTimeX();
+}
+
+/** \brief Return the number of microseconds elapsed since `start`. */
+static inline uint32_t timing_elapsed_us(timing_t start) {
+    return TIME_I2US(chVTTimeElapsedSinceX(start));
+}
+#else
+typedef uint32_t timing_t;
+
+static inline timing_t timing_read(void) {
+    return timer_read32();
+}
+
+static inline uint32_t timing_elapsed_us(timing_t start) {
+    return timer_elapsed32(start) * 1000;
+}
+#endif // PROTOCOL_CHIBIOS
+
+/*
+ * CPU cycle counter.
+ *
+ * Only Cortex-M3 and above have the DWT cycle counter (eg. STM32F4, but not
+ * the RP2040).  `TIMING_HAS_CYCLE_COUNTER` is defined when it is available.
+ */
+
+#if defined(PROTOCOL_CHIBIOS) && (defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__))
+#    define TIMING_HAS_CYCLE_COUNTER
+
+/** \brief Start the DWT cycle counter. */
+static inline void timing_cycles_init(void) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/** \brief Return the current cycle count (wraps). */
+static inline uint32_t timing_cycles_read(void) {
+    return DWT->CYCCNT;
+}
+#endif
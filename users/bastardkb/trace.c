@@ -0,0 +1,154 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <string.h>
+#include "trace.h"
+
+// Matrix keys are recorded as `row << 4 | col`, below the encoder keys.
+_Static_assert(MATRIX_ROWS <= 14 && MATRIX_COLS <= 16, "The trace records matrices of up to 14 rows of 16 columns");
+
+static uint8_t  trace_buffer[TRACE_BUFFER_SIZE];
+static uint16_t trace_head      = 0; // Where the next record is written.
+static uint16_t trace_tail      = 0; // Oldest record.
+static uint16_t trace_used      = 0;
+static uint16_t trace_dropped   = 0;
+static uint16_t trace_last      = 0; // Time of the last record.
+static uint32_t trace_last_read = 0; // When the last record was written, to detect long gaps.
+static bool     trace_paused    = false;
+
+static inline uint16_t trace_index(uint16_t index) {
+    return index >= TRACE_BUFFER_SIZE ? index - TRACE_BUFFER_SIZE : index;
+}
+
+/** \brief Drop the oldest record. */
+static void trace_drop(void) {
+    uint8_t size = 2;
+    switch (trace_buffer[trace_index(trace_tail + 1)] & TRACE_KIND_MASK) {
+        case TRACE_PROCESS:
+            size += 3;
+            break;
+        case TRACE_ACTION:
+            size += 2;
+            break;
+    }
+    while (trace_buffer[trace_index(trace_tail + size)] & 0x80) {
+        ++size;
+    }
+    ++size;
+    trace_tail = trace_index(trace_tail + size);
+    trace_used -= size;
+    ++trace_dropped;
+}
+
+static uint8_t trace_key(keypos_t key) {
+    switch (key.row) {
+        case KEYLOC_ENCODER_CW:
+            return TRACE_KEY_ENCODER_CW | (key.col & 0x0F);
+        case KEYLOC_ENCODER_CCW:
+            return TRACE_KEY_ENCODER_CCW | (key.col & 0x0F);
+    }
+    return key.row < MATRIX_ROWS && key.col < MATRIX_COLS ? key.row << 4 | key.col : TRACE_KEY_NONE;
+}
+
+static uint8_t trace_flags(uint8_t kind, bool pressed) {
+    uint8_t flags = kind | (get_highest_layer(layer_state | default_layer_state) & TRACE_LAYER_MASK);
+    return pressed ? flags | TRACE_PRESSED : flags;
+}
+
+/** \brief Append the time of a record to its first `size` bytes, and write it to the buffer. */
+static void trace_append(uint8_t *entry, uint8_t size, uint16_t time) {
+    int16_t delta = time - trace_last;
+    // Past `INT16_MAX`, the delta would wrap around: clamp it, the decoder
+    // shows an idle gap.
+    if (timer_elapsed32(trace_last_read) >= INT16_MAX) {
+        delta = INT16_MAX;
+    }
+    uint16_t zigzag = (uint16_t)(delta << 1) ^ (uint16_t)(delta >> 15);
+    trace_last      = time;
+    trace_last_read = timer_read32();
+    do {
+        entry[size++] = (zigzag & 0x7F) | (zigzag > 0x7F ? 0x80 : 0);
+        zigzag >>= 7;
+    } while (zigzag);
+
+    while (trace_used + size > TRACE_BUFFER_SIZE) {
+        trace_drop();
+    }
+    for (uint8_t i = 0; i < size; ++i) {
+        trace_buffer[trace_head] = entry[i];
+        trace_head               = trace_index(trace_head + 1);
+    }
+    trace_used += size;
+}
+
+void trace_event(keyrecord_t *record) {
+    if (trace_paused || !(IS_KEYEVENT(record->event) || IS_ENCODEREVENT(record->event))) {
+        return;
+    }
+    uint8_t entry[5] = {trace_key(record->event.key), trace_flags(TRACE_EVENT, record->event.pressed)};
+    trace_append(entry, 2, record->event.time);
+}
+
+void trace_process(uint16_t keycode, keyrecord_t *record) {
+    if (trace_paused || !(IS_KEYEVENT(record->event) || IS_ENCODEREVENT(record->event))) {
+        return;
+    }
+    uint8_t entry[8] = {trace_key(record->event.key), trace_flags(TRACE_PROCESS, record->event.pressed), keycode & 0xFF, keycode >> 8};
+#ifndef NO_ACTION_TAPPING
+    entry[4] = record->tap.count | (record->tap.interrupted ? TRACE_TAP_INTERRUPTED : 0);
+#endif // NO_ACTION_TAPPING
+    trace_append(entry, 5, record->event.time);
+}
+
+void trace_action(keypos_t key, uint16_t keycode, uint8_t flags) {
+    if (trace_paused) {
+        return;
+    }
+    uint8_t entry[7] = {trace_key(key), trace_flags(TRACE_ACTION, flags & TRACE_PRESSED) | (flags & TRACE_TAP), keycode & 0xFF, keycode >> 8};
+    trace_append(entry, 4, timer_read());
+}
+void trace_raw_hid(uint8_t *data, uint8_t length) {
+    uint8_t  command = data[1];
+    uint16_t offset  = data[2] | data[3] << 8;
+    uint8_t  clear   = data[2];
+    memset(&data[2], 0, length - 2);
+    switch (command) {
+        case TRACE_RAW_HID_PAUSE:
+            trace_paused = true;
+            data[2]      = trace_used & 0xFF;
+            data[3]      = trace_used >> 8;
+            data[4]      = trace_dropped & 0xFF;
+            data[5]      = trace_dropped >> 8;
+            break;
+        case TRACE_RAW_HID_READ: {
+            uint8_t count = 0;
+            data[2]       = offset & 0xFF;
+            data[3]       = offset >> 8;
+            for (; count < length - 5 && offset + count < trace_used; ++count) {
+                data[5 + count] = trace_buffer[trace_index(trace_tail + offset + count)];
+            }
+            data[4] = count;
+            break;
+        }
+        case TRACE_RAW_HID_RESUME:
+            if (clear) {
+                trace_head = trace_tail = trace_used = 0;
+            }
+            trace_dropped = 0;
+            trace_paused  = false;
+            break;
+    }
+}
@@ -0,0 +1,114 @@
+/**
+ * Copyright 2026 eddieurfaust (@eddieurfaust)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <stdint.h>
+#include "quantum.h"
+
+/*
+ * Key event trace recorder.
+ *
+ * Three kinds of records are appended to a RAM ring buffer; once full, the
+ * oldest records are dropped:
+ *
+ * - event: a key press or release as scanned, from `pre_process_record`,
+ *   before the combo, encoder batching and tap-hold modules swallow any;
+ * - process: an event reaching `process_record`, with the keycode it resolved
+ *   to and its tap state (tap-hold keys only);
+ * - action: a keycode registered by a userspace module instead of a key event,
+ *   eg. a combo firing, an instant tap or a batched encoder tap.
+ *
+ * A record is:
+ *
+ * - 1 byte:  key, `row << 4 | col` for matrix keys, `TRACE_KEY_ENCODER_CW` or
+ *            `TRACE_KEY_ENCODER_CCW` ORed with the index for encoders, or
+ *            `TRACE_KEY_NONE`;
+ * - 1 byte:  `trace_flags`, with the record kind and the highest active layer;
+ * - 2 bytes: process and action records only, the keycode, little endian;
+ * - 1 byte:  process records only, the tap count, ORed with
+ *            `TRACE_TAP_INTERRUPTED`;
+ * - 1+ byte: time since the previous record, in milliseconds, as a zigzag
+ *            LEB128 varint (process records are late when a tap-hold key held
+ *            them back).  Gaps of `INT16_MAX` ms or more are recorded as
+ *            `INT16_MAX`.
+ *
+ * Typing takes 3 bytes per event record and 6 per process record, 18 bytes per
+ * key tap, so the default buffer holds the last 50 or so taps, several seconds
+ * of typing.  The buffer is read over raw HID, see `util/trace.py`.
+ */
+
+#ifndef TRACE_BUFFER_SIZE
+/** \brief Size of the ring buffer, in bytes. */
+#    define TRACE_BUFFER_SIZE 1024
+#endif // TRACE_BUFFER_SIZE
+
+enum trace_flags {
+    TRACE_PRESSED    = 1 << 7,
+    TRACE_TAP        = 1 << 6, // Action records: the keycode was tapped, ie. pressed and released.
+    TRACE_KIND_MASK  = 3 << 4,
+    TRACE_LAYER_MASK = 0x0F,
+};
+
+enum trace_kind {
+    TRACE_EVENT   = 0 << 4,
+    TRACE_PROCESS = 1 << 4,
+    TRACE_ACTION  = 2 << 4,
+};
+
+enum trace_key {
+    TRACE_KEY_ENCODER_CW  = 0xE0,
+    TRACE_KEY_ENCODER_CCW = 0xF0,
+    TRACE_KEY_NONE        = 0xFF,
+};
+
+/** \brief Set in the tap byte of process records when the tap-hold key was interrupted. */
+#define TRACE_TAP_INTERRUPTED 0x80
+
+/** \brief Key of action records not coming from a single key. */
+#define TRACE_NO_KEY ((keypos_t){.row = UINT8_MAX, .col = UINT8_MAX})
+
+/** \brief Raw HID subcommands, sent as the second byte of a `RAW_HID_TRACE` report. */
+enum trace_raw_hid_command {
+    /**
+     * \brief Pause recording, and return the number of bytes in the buffer.
+     *
+     * Response: `[cmd, sub, used:2, dropped:2]`, little endian; `dropped` is the
+     * number of records dropped since the last `TRACE_RAW_HID_RESUME`.
+     */
+    TRACE_RAW_HID_PAUSE = 0,
+    /**
+     * \brief Read the buffer, from the oldest record.
+     *
+     * Request: `[cmd, sub, offset:2]`.  Response: `[cmd, sub, offset:2, count,
+     * data...]`.
+     */
+    TRACE_RAW_HID_READ = 1,
+    /**
+     * \brief Resume recording.
+     *
+     * Request: `[cmd, sub, clear]`, the buffer is cleared if `clear` is not 0.
+     */
+    TRACE_RAW_HID_RESUME = 2,
+};
+
+/** \brief Record a scanned event, from `pre_process_record`. */
+void trace_event(keyrecord_t *record);
+/** \brief Record an event reaching `process_record`, with its keycode. */
+void trace_process(uint16_t keycode, keyrecord_t *record);
+/** \brief Record a keycode registered (`TRACE_PRESSED`), unregistered or tapped (`TRACE_TAP`) by a module. */
+void trace_action(keypos_t key, uint16_t keycode, uint8_t flags);
+void trace_raw_hid(uint8_t *data, uint8_t length);
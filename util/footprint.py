@@ -0,0 +1,238 @@
+#!/usr/bin/env python3
+# Copyright 2026 eddieurfaust (@eddieurfaust)
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+"""Measure the firmware footprint of every keymap of the userspace.
+
+Builds each build target of `qmk.json` with `qmk compile`, once as configured
+and once with each feature turned off, and extracts from every build:
+
+- flash (`.text` + `.data`) and RAM (`.data` + `.bss`), with the toolchain's `size`;
+- the largest single stack frame of the userspace and keymap functions, with
+  `-fstack-usage` (not the stack usage, which depends on the call chains).
+
+The script fails if a build leaves less than `--min-headroom` percent of its
+MCU's flash or RAM free.  The figures are also compared with a stored
+baseline: it fails if any of them grew by more than the threshold, if a build
+that succeeded in the baseline fails, or if there is no baseline.  Targets the
+baseline has no figures for are only checked for headroom.  `--update` writes
+the baseline instead, along with the qmk_firmware commit it was recorded
+against, which CI builds with.
+"""
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+from pathlib import Path
+
+USERSPACE = Path(__file__).resolve().parent.parent
+DEFAULT_BASELINE = USERSPACE / 'util' / 'footprint_baseline.json'
+
+# Each variant turns off one feature; its cost is the difference with `default`.
+VARIANTS = {
+    'default': {},
+    'no_combo': {'COMBO_ENABLE': 'no', 'INDEXED_COMBO_ENABLE': 'no'},
+    'no_tap_dance': {'TAP_DANCE_ENABLE': 'no'},
+    'no_pointing': {'POINTING_DEVICE_ENABLE': 'no'},
+    'no_rgb': {'RGB_MATRIX_ENABLE': 'no'},
+    'no_via': {'VIA_ENABLE': 'no'},
+}
+
+METRICS = ('flash', 'ram', 'largest_stack_frame')
+
+# ELF machine types, and the matching `size` tool.
+SIZE_TOOLS = {0x28: 'arm-none-eabi-size', 0x53: 'avr-size'}
+
+# Flash and RAM available to the firmware on the controllers of the keyboards,
+# by QMK processor name, in bytes.  Flash excludes a bootloader stored in it.
+MCU_LIMITS = {
+    'atmega32u4': (28 * 1024, 2560),  # 4 KiB bootloader (Caterina, DFU).
+    'STM32F401': (192 * 1024, 64 * 1024),  # 64 KiB tinyuf2 bootloader.
+    'STM32F411': (448 * 1024, 128 * 1024),  # 64 KiB tinyuf2 bootloader.
+    'RP2040': (2 * 1024 * 1024, 264 * 1024),  # 2 MiB external flash, the smallest fitted.
+}
+
+# Where the fork the builds are checked against lives, when the baseline does not say.
+QMK_REPOSITORY = 'bastardkb/bastardkb-qmk'
+
+
+def build_targets():
+    qmk_json = json.loads((USERSPACE / 'qmk.json').read_text())
+    return [f'{keyboard}:{keymap}' for keyboard, keymap in qmk_json['build_targets']]
+
+
+def compile_target(target, variant, build_dir, jobs):
+    """Build a target in its own build directory, and return the path of its ELF."""
+    keyboard, keymap = target.split(':')
+    command = ['qmk', 'compile', '-kb', keyboard, '-km', keymap, '-j', str(jobs), '-e', f'BUILD_DIR={build_dir}', '-e', 'EXTRAFLAGS=-fstack-usage']
+    for name, value in VARIANTS[variant].items():
+        command += ['-e', f'{name}={value}']
+    environment = dict(os.environ, QMK_USERSPACE=str(USERSPACE))
+    # Outputs of a previous build would be measured if this one skips them.
+    for stale in [*build_dir.rglob('*.su'), *build_dir.glob('*.elf')]:
+        stale.unlink()
+    result = subprocess.run(command, cwd=USERSPACE, env=environment, capture_output=True, text=True)
+    if result.returncode != 0:
+        return None
+    elves = sorted(build_dir.glob('*.elf'), key=lambda path: path.stat().st_mtime)
+    return elves[-1] if elves else None
+
+
+def processor(target):
+    """Return the QMK processor name of a target's keyboard, or None."""
+    keyboard = target.split(':')[0]
+    environment = dict(os.environ, QMK_USERSPACE=str(USERSPACE))
+    result = subprocess.run(['qmk', 'info', '-kb', keyboard, '-f', 'json'], cwd=USERSPACE, env=environment, capture_output=True, text=True)
+    if result.returncode != 0:
+        return None
+    return json.loads(result.stdout).get('processor')
+
+
+def qmk_firmware_commit():
+    """Return the commit of the qmk_firmware tree the targets are built with, or None."""
+    root = os.environ.get('QMK_FIRMWARE_ROOT')
+    if not root:
+        return None
+    result = subprocess.run(['git', '-C', root, 'rev-parse', 'HEAD'], capture_output=True, text=True)
+    return result.stdout.strip() if result.returncode == 0 else None
+
+
+def section_sizes(elf):
+    """Return the `text`, `data` and `bss` sizes of an ELF."""
+    machine = int.from_bytes(elf.read_bytes()[18:20], 'little')
+    output = subprocess.run([SIZE_TOOLS.get(machine, 'size'), '-B', str(elf)], check=True, capture_output=True, text=True).stdout
+    text, data, bss = (int(value) for value in output.splitlines()[1].split()[:3])
+    return text, data, bss
+
+
+def largest_stack_frame(build_dir):
+    """Return the largest single stack frame of the userspace and keymap functions, and its function."""
+    largest = (0, None)
+    for su in build_dir.rglob('*.su'):
+        for line in su.read_text().splitlines():
+            match = re.match(r'(.+):\d+:\d+:(\S+)\s+(\d+)\s+\S+', line)
+            if not match or not re.search(r'users/bastardkb/|/keymaps/', match.group(1)):
+                continue
+            largest = max(largest, (int(match.group(3)), f'{Path(match.group(1)).name}:{match.group(2)}'), key=lambda frame: frame[0])
+    return largest
+
+
+def measure(target, variant, work_dir, jobs):
+    build_dir = work_dir / target.replace('/', '_').replace(':', '_') / variant
+    elf = compile_target(target, variant, build_dir, jobs)
+    if elf is None:
+        return None
+    text, data, bss = section_sizes(elf)
+    frame, function = largest_stack_frame(build_dir)
+    return {'flash': text + data, 'ram': data + bss, 'data': data, 'bss': bss, 'largest_stack_frame': frame, 'largest_stack_frame_function': function}
+
+
+def print_results(results, processors):
+    for target, variants in results.items():
+        limits = MCU_LIMITS.get(processors.get(target))
+        print(f'{target} ({processors.get(target) or "unknown processor"})')
+        default = variants.get('default')
+        for variant, figures in variants.items():
+            if figures is None:
+                print(f'    {variant:14} build failed')
+                continue
+            line = f'    {variant:14} flash {figures["flash"]:7} ram {figures["ram"]:6} (data {figures["data"]}, bss {figures["bss"]})'
+            if limits:
+                line += f', free {limits[0] - figures["flash"]} B flash, {limits[1] - figures["ram"]} B ram'
+            line += f', largest stack frame {figures["largest_stack_frame"]:4} ({figures["largest_stack_frame_function"]})'
+            if default and variant != 'default':
+                line += f'  feature costs {default["flash"] - figures["flash"]} B flash, {default["ram"] - figures["ram"]} B ram'
+            print(line)
+
+
+def check_headroom(results, processors, min_headroom):
+    """Return the builds leaving less than `min_headroom` percent of their MCU's flash or RAM free."""
+    failures = []
+    for target, variants in results.items():
+        limits = MCU_LIMITS.get(processors.get(target))
+        if limits is None:
+            print(f'NOTE {target}: no flash and RAM sizes for processor {processors.get(target)}, headroom not checked')
+            continue
+        for variant, figures in variants.items():
+            if figures is None:
+                continue
+            for metric, limit in zip(('flash', 'ram'), limits):
+                if figures[metric] > limit * (1 - min_headroom / 100):
+                    failures.append(f'{target} {variant}: {metric} {figures[metric]} of {limit} B, less than {min_headroom}% free')
+    return failures
+
+
+def compare(results, baseline, threshold):
+    """Return the figures that grew by more than `threshold` percent over the baseline."""
+    regressions = []
+    for target, variants in results.items():
+        if target not in baseline:
+            print(f'NOTE {target}: not in the baseline, only its headroom is checked')
+            if 'default' in variants and variants['default'] is None:
+                regressions.append(f'{target} default: build failed')
+            continue
+        for variant, figures in variants.items():
+            previous = baseline[target].get(variant)
+            if previous is None:
+                continue
+            if figures is None:
+                regressions.append(f'{target} {variant}: build failed')
+                continue
+            for metric in METRICS:
+                limit = previous[metric] * (1 + threshold / 100)
+                if figures[metric] > limit:
+                    regressions.append(f'{target} {variant}: {metric} {previous[metric]} -> {figures[metric]}')
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('targets', nargs='*', help='keyboard:keymap targets, all the build targets of qmk.json by default')
+    parser.add_argument('--variants', nargs='+', choices=VARIANTS, default=list(VARIANTS), help='feature variants to build')
+    parser.add_argument('--baseline', type=Path, default=DEFAULT_BASELINE, help='baseline to compare with')
+    parser.add_argument('--update', action='store_true', help='write the results to the baseline instead of comparing')
+    parser.add_argument('--threshold', type=float, default=0.0, help='allowed growth over the baseline, in percent')
+    parser.add_argument('--min-headroom', type=float, default=5.0, help='flash and RAM to leave free on each MCU, in percent')
+    parser.add_argument('--build-dir', type=Path, default=USERSPACE / '.build' / 'footprint', help='where to build')
+    parser.add_argument('-j', '--jobs', type=int, default=os.cpu_count(), help='parallel build jobs')
+    args = parser.parse_args()
+
+    results, processors = {}, {}
+    for target in args.targets or build_targets():
+        processors[target] = processor(target)
+        results[target] = {variant: measure(target, variant, args.build_dir.resolve(), args.jobs) for variant in args.variants}
+    print_results(results, processors)
+    failures = check_headroom(results, processors, args.min_headroom)
+
+    if args.update:
+        baseline = {'qmk_firmware': {'repository': QMK_REPOSITORY, 'commit': qmk_firmware_commit()}, 'targets': results}
+        args.baseline.write_text(json.dumps(baseline, indent=4, sort_keys=True) + '\n')
+        print(f'Baseline written to {args.baseline}')
+    elif not args.baseline.exists():
+        failures.append(f'no baseline at {args.baseline}, run with --update to create it')
+    else:
+        baseline = json.loads(args.baseline.read_text())
+        commit = qmk_firmware_commit()
+        if commit and baseline['qmk_firmware'].get('commit') not in (None, commit):
+            print(f'NOTE the baseline was recorded against qmk_firmware {baseline["qmk_firmware"]["commit"]}, not {commit}')
+        failures += compare(results, baseline['targets'], args.threshold)
+    for failure in failures:
+        print(f'FAIL {failure}')
+    return 1 if failures else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
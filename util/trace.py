@@ -0,0 +1,205 @@
+#!/usr/bin/env python3
+# Copyright 2026 eddieurfaust (@eddieurfaust)
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+"""Read the key event trace of a keyboard and print it as a timeline.
+
+`dump` reads the trace over raw HID (requires the `hid` package, from hidapi)
+and prints it, optionally saving the raw bytes.  `decode` prints a trace saved
+by `dump --save`, or with `--replay` its scanned events in the text format of
+the host tests' `replay` target.  See `users/bastardkb/trace.h` for the format.
+"""
+import argparse
+import sys
+from pathlib import Path
+
+RAW_HID_TRACE = 0xB1
+TRACE_RAW_HID_PAUSE = 0
+TRACE_RAW_HID_READ = 1
+TRACE_RAW_HID_RESUME = 2
+
+# QMK's raw HID interface.
+RAW_USAGE_PAGE = 0xFF60
+RAW_USAGE = 0x61
+RAW_REPORT_SIZE = 32
+
+TRACE_PRESSED = 1 << 7
+TRACE_TAP = 1 << 6
+TRACE_KIND_MASK = 3 << 4
+TRACE_LAYER_MASK = 0x0F
+TRACE_EVENT = 0 << 4
+TRACE_PROCESS = 1 << 4
+TRACE_ACTION = 2 << 4
+TRACE_KEY_ENCODER_CW = 0xE0
+TRACE_KEY_ENCODER_CCW = 0xF0
+TRACE_KEY_NONE = 0xFF
+TRACE_TAP_INTERRUPTED = 0x80
+# Time deltas are clamped to this, the actual gap was at least as long.
+TRACE_IDLE = 0x7FFF
+
+
+class Record:
+    def __init__(self, kind, key, flags):
+        self.kind, self.key, self.flags = kind, key, flags
+        self.keycode, self.tap, self.time, self.idle = None, None, 0, False
+
+    @property
+    def pressed(self):
+        return bool(self.flags & TRACE_PRESSED)
+
+    def key_name(self):
+        if self.key == TRACE_KEY_NONE:
+            return '-'
+        if self.key & 0xF0 == TRACE_KEY_ENCODER_CCW:
+            return f'enc{self.key & 0x0F} ccw'
+        if self.key & 0xF0 == TRACE_KEY_ENCODER_CW:
+            return f'enc{self.key & 0x0F} cw'
+        return f'r{self.key >> 4}c{self.key & 0x0F}'
+
+
+def decode(data):
+    """Return the records of a trace, times in milliseconds relative to the first record."""
+    records, position, time = [], 0, None
+    while position + 2 < len(data):
+        record = Record(data[position + 1] & TRACE_KIND_MASK, data[position], data[position + 1])
+        position += 2
+        if record.kind in (TRACE_PROCESS, TRACE_ACTION):
+            record.keycode = data[position] | data[position + 1] << 8
+            position += 2
+        if record.kind == TRACE_PROCESS:
+            record.tap = data[position]
+            position += 1
+        zigzag, shift = 0, 0
+        while True:
+            byte = data[position]
+            position += 1
+            zigzag |= (byte & 0x7F) << shift
+            shift += 7
+            if not byte & 0x80:
+                break
+        delta = (zigzag >> 1) ^ -(zigzag & 1)
+        # The first record's delta is relative to a record that was dropped.
+        record.idle = time is not None and delta == TRACE_IDLE
+        time = 0 if time is None else time + delta
+        record.time = time
+        records.append(record)
+    return records
+
+
+def print_timeline(records, dropped=0):
+    if dropped:
+        print(f'({dropped} older records dropped)')
+    previous = 0
+    for record in records:
+        if record.idle:
+            print(f'(idle for {TRACE_IDLE // 100 / 10} s or more, later times are a lower bound)')
+        details = []
+        if record.kind == TRACE_EVENT:
+            kind = 'event  '
+            action = 'press  ' if record.pressed else 'release'
+        elif record.kind == TRACE_PROCESS:
+            kind = 'process'
+            action = 'press  ' if record.pressed else 'release'
+            details.append(f'0x{record.keycode:04X}')
+            if record.tap & 0x0F:
+                details.append(f'tap {record.tap & 0x0F}')
+            if record.tap & TRACE_TAP_INTERRUPTED:
+                details.append('interrupted')
+        else:
+            kind = 'action '
+            action = 'tap    ' if record.flags & TRACE_TAP else 'press  ' if record.pressed else 'release'
+            details.append(f'0x{record.keycode:04X}')
+        print(f'{record.time:7} ms  (+{record.time - previous:5})  {kind}  {action}  {record.key_name():9}  layer {record.flags & TRACE_LAYER_MASK:2}  {" ".join(details)}')
+        previous = record.time
+
+
+def print_replay(records):
+    """Print the scanned matrix events, as `<ms> <row> <col> <pressed>` lines."""
+    for record in records:
+        if record.kind == TRACE_EVENT and record.key < TRACE_KEY_ENCODER_CW:
+            print(f'{record.time} {record.key >> 4} {record.key & 0x0F} {int(record.pressed)}')
+
+
+def open_device(vid, pid):
+    import hid
+
+    for device in hid.enumerate(vid or 0, pid or 0):
+        if device['usage_page'] == RAW_USAGE_PAGE and device['usage'] == RAW_USAGE:
+            handle = hid.device()
+            handle.open_path(device['path'])
+            return handle
+    raise SystemExit('No raw HID interface found')
+
+
+def request(device, *payload):
+    report = bytes([RAW_HID_TRACE, *payload]).ljust(RAW_REPORT_SIZE, b'\0')
+    # The first byte is the report ID, QMK's raw HID has none.
+    device.write(b'\0' + report)
+    response = bytes(device.read(RAW_REPORT_SIZE, 1000))
+    if len(response) < RAW_REPORT_SIZE or response[0] != RAW_HID_TRACE:
+        raise SystemExit('No trace response, is TRACE_ENABLE on (and VIA off)?')
+    return response
+
+
+def dump(device, clear):
+    """Pause the recorder, read the whole buffer and resume."""
+    response = request(device, TRACE_RAW_HID_PAUSE)
+    used = response[2] | response[3] << 8
+    dropped = response[4] | response[5] << 8
+    data = bytearray()
+    try:
+        while len(data) < used:
+            response = request(device, TRACE_RAW_HID_READ, len(data) & 0xFF, len(data) >> 8)
+            count = response[4]
+            if count == 0:
+                break
+            data += response[5:5 + count]
+    finally:
+        request(device, TRACE_RAW_HID_RESUME, 1 if clear else 0)
+    return bytes(data), dropped
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    subparsers = parser.add_subparsers(dest='command', required=True)
+    dump_parser = subparsers.add_parser('dump', help='read the trace from the keyboard')
+    dump_parser.add_argument('--vid', type=lambda value: int(value, 16), help='USB vendor ID, in hex')
+    dump_parser.add_argument('--pid', type=lambda value: int(value, 16), help='USB product ID, in hex')
+    dump_parser.add_argument('--clear', action='store_true', help='clear the trace after reading it')
+    dump_parser.add_argument('--save', type=Path, help='also write the raw trace to this file')
+    decode_parser = subparsers.add_parser('decode', help='print a trace saved with `dump --save`')
+    decode_parser.add_argument('--replay', action='store_true', help='print the scanned events, to replay them in the host tests')
+    decode_parser.add_argument('file', type=Path)
+    args = parser.parse_args()
+
+    if args.command == 'decode':
+        records = decode(args.file.read_bytes())
+        if args.replay:
+            print_replay(records)
+        else:
+            print_timeline(records)
+        return 0
+    device = open_device(args.vid, args.pid)
+    try:
+        data, dropped = dump(device, args.clear)
+    finally:
+        device.close()
+    if args.save:
+        args.save.write_bytes(data)
+    print_timeline(decode(data), dropped)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())